@@ -0,0 +1,85 @@
+# SPDX-License-Identifier: MIT
+
+#[=======================================================================[.rst:
+FindCHOLMOD
+-----------
+
+Find the CHOLMOD sparse Cholesky factorisation of SuiteSparse.
+
+The CMake package installed by SuiteSparse 7 and later is used when it is found. Otherwise the
+headers and the libraries of CHOLMOD and of the SuiteSparse libraries it depends on
+(suitesparseconfig, amd, colamd, camd and, if installed, ccolamd) are searched directly.
+
+Imported targets
+^^^^^^^^^^^^^^^^
+
+``CHOLMOD::CHOLMOD``
+  The CHOLMOD library and its dependencies.
+
+Result variables
+^^^^^^^^^^^^^^^^
+
+``CHOLMOD_FOUND``
+  True if CHOLMOD was found.
+#]=======================================================================]
+
+find_package(CHOLMOD CONFIG QUIET)
+if("${CHOLMOD_FOUND}")
+  if(NOT TARGET CHOLMOD::CHOLMOD)
+    add_library(CHOLMOD::CHOLMOD INTERFACE IMPORTED)
+    if(TARGET SuiteSparse::CHOLMOD)
+      target_link_libraries(CHOLMOD::CHOLMOD INTERFACE SuiteSparse::CHOLMOD)
+    else()
+      target_link_libraries(CHOLMOD::CHOLMOD INTERFACE SuiteSparse::CHOLMOD_static)
+    endif()
+  endif()
+  include(FindPackageHandleStandardArgs)
+  find_package_handle_standard_args(CHOLMOD CONFIG_MODE)
+  return()
+endif()
+
+find_path(CHOLMOD_INCLUDE_DIR cholmod.h PATH_SUFFIXES suitesparse)
+find_library(CHOLMOD_LIBRARY cholmod)
+find_library(CHOLMOD_SUITESPARSECONFIG_LIBRARY suitesparseconfig)
+find_library(CHOLMOD_AMD_LIBRARY amd)
+find_library(CHOLMOD_COLAMD_LIBRARY colamd)
+find_library(CHOLMOD_CAMD_LIBRARY camd)
+find_library(CHOLMOD_CCOLAMD_LIBRARY ccolamd)
+mark_as_advanced(
+  CHOLMOD_INCLUDE_DIR
+  CHOLMOD_LIBRARY
+  CHOLMOD_SUITESPARSECONFIG_LIBRARY
+  CHOLMOD_AMD_LIBRARY
+  CHOLMOD_COLAMD_LIBRARY
+  CHOLMOD_CAMD_LIBRARY
+  CHOLMOD_CCOLAMD_LIBRARY)
+
+include(FindPackageHandleStandardArgs)
+find_package_handle_standard_args(CHOLMOD
+  REQUIRED_VARS
+    CHOLMOD_LIBRARY
+    CHOLMOD_INCLUDE_DIR
+    CHOLMOD_SUITESPARSECONFIG_LIBRARY
+    CHOLMOD_AMD_LIBRARY
+    CHOLMOD_COLAMD_LIBRARY
+    CHOLMOD_CAMD_LIBRARY)
+
+if("${CHOLMOD_FOUND}" AND NOT TARGET CHOLMOD::CHOLMOD)
+  add_library(CHOLMOD::CHOLMOD UNKNOWN IMPORTED)
+  set_target_properties(CHOLMOD::CHOLMOD PROPERTIES
+    IMPORTED_LOCATION "${CHOLMOD_LIBRARY}"
+    INTERFACE_INCLUDE_DIRECTORIES "${CHOLMOD_INCLUDE_DIR}")
+  set(_cholmod_dependencies
+    "${CHOLMOD_AMD_LIBRARY}"
+    "${CHOLMOD_COLAMD_LIBRARY}"
+    "${CHOLMOD_CAMD_LIBRARY}")
+  if(CHOLMOD_CCOLAMD_LIBRARY)
+    list(APPEND _cholmod_dependencies "${CHOLMOD_CCOLAMD_LIBRARY}")
+  endif()
+  # the supernodal factorisation calls BLAS and LAPACK
+  target_link_libraries(CHOLMOD::CHOLMOD INTERFACE
+    ${_cholmod_dependencies}
+    "${CHOLMOD_SUITESPARSECONFIG_LIBRARY}"
+    LAPACK::LAPACK)
+  unset(_cholmod_dependencies)
+endif()
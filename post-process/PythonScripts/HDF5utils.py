@@ -72,6 +72,20 @@ class loadHDF5():
             str_var_new = name_map[str_var_new]
         return str_var_new
 
+    @staticmethod
+    def get_dtype(dset):
+        """ Type in which a dataset is loaded, datasets stored in reduced
+        precision are converted back to double precision
+
+        Parameters
+        ----------
+        dset : h5.Dataset
+               The dataset to be read
+        """
+        if np.issubdtype(dset.dtype, np.floating):
+            return np.float64
+        return dset.dtype
+
     def collect_group(self, fh5, name_map, group):
         """ Collect all elements from a group from a HDF5 file
         """
@@ -94,7 +108,7 @@ class loadHDF5():
                     if isinstance(var, np.generic):
                         var = var.item()
                 else:
-                    var = np.array(var_tmp, order='C')
+                    var = np.array(var_tmp, dtype=self.get_dtype(var_tmp), order='C')
 
             group.add_attr(str_var_new, var)
 
@@ -132,7 +146,7 @@ class loadHDF5():
                     # Fortran ordering is used as we index by time a lot
 
                     var = np.empty(shape = (nb_diag,*var_tmp.shape),
-                                   dtype = var_tmp.dtype,
+                                   dtype = self.get_dtype(var_tmp),
                                    order='C')
                 group.add_attr(str_var_new, var)
             else:
@@ -15,6 +15,7 @@ import yaml
 
 import dask.array as da
 import h5py as h5
+import numpy as np
 import xarray as xr
 
 from . import coord_getters
@@ -162,6 +163,10 @@ class Store(object):
                             )
 
                         data = da.from_array(dset_value)
+                        # Datasets stored in reduced precision (see the `datasets` section
+                        # of the PDI configuration) are converted back to double precision
+                        if np.issubdtype(data.dtype, np.floating) and data.dtype != np.float64:
+                            data = data.astype(np.float64)
 
                         # Small verification the match between the coordinates and the data.
                         target_ndim = len(coords)
@@ -3,10 +3,9 @@
 #include <chrono>
 #include <cmath>
 #include <cstdlib>
-#include <filesystem>
-#include <fstream>
 #include <iostream>
-#include <string_view>
+#include <optional>
+#include <string>
 
 #include <ddc/ddc.hpp>
 
@@ -30,15 +29,13 @@
 #include "params.yaml.hpp"
 #include "pdi_out.yml.hpp"
 #include "predcorr.hpp"
+#include "simulation_io.hpp"
 #include "singlemodeperturbinitialization.hpp"
 #include "species_info.hpp"
 #include "spline_interpolator.hpp"
 #include "splitvlasovsolver.hpp"
 
-using std::cerr;
-using std::endl;
 using std::chrono::steady_clock;
-namespace fs = std::filesystem;
 
 using PreallocatableSplineInterpolatorX
         = PreallocatableSplineInterpolator<IDimX, BSplinesX, SplineXBoundary, SplineXBoundary>;
@@ -55,17 +52,10 @@ int main(int argc, char** argv)
     ddc::ScopeGuard scope(argc, argv);
 
     PC_tree_t conf_voicexx;
-    if (argc == 2) {
-        conf_voicexx = PC_parse_path(fs::path(argv[1]).c_str());
-    } else if (argc == 3) {
-        if (argv[1] == std::string_view("--dump-config")) {
-            std::fstream file(argv[2], std::fstream::out);
-            file << params_yaml;
-            return EXIT_SUCCESS;
-        }
-    } else {
-        cerr << "usage: " << argv[0] << " [--dump-config] <config_file.yml>" << endl;
-        return EXIT_FAILURE;
+    std::string restart_file;
+    if (std::optional<int> const exit_status
+        = parse_executable_arguments(conf_voicexx, restart_file, argc, argv, params_yaml)) {
+        return *exit_status;
     }
     PC_errhandler(PC_NULL_HANDLER);
 
@@ -159,7 +149,6 @@ int main(int argc, char** argv)
             init(allfequilibrium,
                  ddc::discrete_space<IDimSp>().perturb_modes(),
                  ddc::discrete_space<IDimSp>().perturb_amplitudes());
-    init(allfdistribu);
 
     // --> Algorithm info
     double const deltat = PCpp_double(conf_voicexx, ".Algorithm.deltat");
@@ -168,6 +157,9 @@ int main(int argc, char** argv)
     // --> Output info
     double const time_diag = PCpp_double(conf_voicexx, ".Output.time_diag");
     int const nbstep_diag = int(time_diag / deltat);
+    // checkpoints are only written if their period is given
+    int const nbstep_checkpoint
+            = read_nbstep(conf_voicexx, ".Output.time_checkpoint", deltat, nbiter + 1);
 
     PC_tree_t conf_pdi = PC_parse_string(PDI_CFG);
 
@@ -200,7 +192,7 @@ int main(int argc, char** argv)
 #else
     using FemPoissonSolverX = FemNonPeriodicPoissonSolver;
 #endif
-    FemPoissonSolverX const poisson(builder_x, spline_x_evaluator, builder_vx, spline_vx_evaluator);
+    FemPoissonSolverX const poisson(builder_x, spline_x_evaluator, builder_vx);
 
     PredCorr const predcorr(vlasov, poisson);
 
@@ -223,14 +215,17 @@ int main(int argc, char** argv)
     ddc::expose_to_pdi("MeshX", meshX_coord);
     ddc::expose_to_pdi("MeshVx", meshVx_coord);
     ddc::expose_to_pdi("nbstep_diag", nbstep_diag);
+    ddc::expose_to_pdi("nbstep_checkpoint", nbstep_checkpoint);
     ddc::expose_to_pdi("Nkinspecies", nb_kinspecies.value());
     ddc::expose_to_pdi("fdistribu_charges", ddc::discrete_space<IDimSp>().charges()[dom_kinsp]);
     ddc::expose_to_pdi("fdistribu_masses", ddc::discrete_space<IDimSp>().masses()[dom_kinsp]);
     ddc::PdiEvent("initial_state").with("fdistribu_eq", allfequilibrium);
 
+    int const iter_start = initialize_or_restart(restart_file, allfdistribu, init);
+
     steady_clock::time_point const start = steady_clock::now();
 
-    predcorr(allfdistribu, deltat, nbiter);
+    predcorr(allfdistribu, deltat, nbiter - iter_start, iter_start);
 
     steady_clock::time_point const end = steady_clock::now();
 
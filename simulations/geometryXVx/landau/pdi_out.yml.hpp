@@ -7,7 +7,11 @@ metadata:
   iter : int
   time_saved : double
   nbstep_diag: int
+  nbstep_checkpoint: int
+  restart_file_size: int
+  restart_file: { type: array, subtype: char, size: '$restart_file_size' }
   iter_saved : int
+  iter_start: int
   MeshX_extents: { type: array, subtype: int64, size: 1 }
   MeshX:
     type: array
@@ -36,6 +40,7 @@ metadata:
     size: [ '$fdistribu_eq_extents[0]', '$fdistribu_eq_extents[1]' ]
 
 data:
+  iter_restart: int
   fdistribu_extents: { type: array, subtype: int64, size: 3 }
   fdistribu:
     type: array
@@ -46,6 +51,67 @@ data:
     type: array
     subtype: double
     size: [ '$electrostatic_potential_extents[0]' ]
+  field_energy: double
+  kinetic_energy_extents: { type: array, subtype: int64, size: 1 }
+  kinetic_energy:
+    type: array
+    subtype: double
+    size: [ '$kinetic_energy_extents[0]' ]
+  modes_extents: { type: array, subtype: int64, size: 1 }
+  modes:
+    type: array
+    subtype: int
+    size: [ '$modes_extents[0]' ]
+  electrostatic_potential_modes_extents: { type: array, subtype: int64, size: 1 }
+  electrostatic_potential_modes:
+    type: array
+    subtype: double
+    size: [ '$electrostatic_potential_modes_extents[0]' ]
+  particle_flux_left_extents: { type: array, subtype: int64, size: 1 }
+  particle_flux_left:
+    type: array
+    subtype: double
+    size: [ '$particle_flux_left_extents[0]' ]
+  particle_flux_right_extents: { type: array, subtype: int64, size: 1 }
+  particle_flux_right:
+    type: array
+    subtype: double
+    size: [ '$particle_flux_right_extents[0]' ]
+  energy_flux_left_extents: { type: array, subtype: int64, size: 1 }
+  energy_flux_left:
+    type: array
+    subtype: double
+    size: [ '$energy_flux_left_extents[0]' ]
+  energy_flux_right_extents: { type: array, subtype: int64, size: 1 }
+  energy_flux_right:
+    type: array
+    subtype: double
+    size: [ '$energy_flux_right_extents[0]' ]
+  density_extents: { type: array, subtype: int64, size: 2 }
+  density:
+    type: array
+    subtype: double
+    size: [ '$density_extents[0]', '$density_extents[1]' ]
+  mean_velocity_extents: { type: array, subtype: int64, size: 2 }
+  mean_velocity:
+    type: array
+    subtype: double
+    size: [ '$mean_velocity_extents[0]', '$mean_velocity_extents[1]' ]
+  temperature_extents: { type: array, subtype: int64, size: 2 }
+  temperature:
+    type: array
+    subtype: double
+    size: [ '$temperature_extents[0]', '$temperature_extents[1]' ]
+  particle_flux_extents: { type: array, subtype: int64, size: 2 }
+  particle_flux:
+    type: array
+    subtype: double
+    size: [ '$particle_flux_extents[0]', '$particle_flux_extents[1]' ]
+  heat_flux_extents: { type: array, subtype: int64, size: 2 }
+  heat_flux:
+    type: array
+    subtype: double
+    size: [ '$heat_flux_extents[0]', '$heat_flux_extents[1]' ]
 
 plugins:
   set_value:
@@ -68,5 +134,27 @@ plugins:
       when: '${iter} % ${nbstep_diag} = 0'
       collision_policy: replace_and_warn
       write: [time_saved, fdistribu, electrostatic_potential]
+    - file: 'VOICEXX_checkpoint_${iter:06}.h5'
+      on_event: [iteration]
+      when: '${iter} > ${iter_start} & ${iter} % ${nbstep_checkpoint} = 0'
+      collision_policy: replace_and_warn
+      write: [iter, time_saved, fdistribu]
+    - file: '${restart_file}'
+      on_event: [restart]
+      read:
+        iter_restart: { dataset: iter }
+        fdistribu: ~
+    - file: 'VOICEXX_modes.h5'
+      on_event: [reduced_diagnostics]
+      collision_policy: replace_and_warn
+      write: [modes]
+    - file: 'VOICEXX_scalars_${iter:06}.h5'
+      on_event: [scalar_diagnostics]
+      collision_policy: replace_and_warn
+      write: [time_saved, field_energy, kinetic_energy, electrostatic_potential_modes, particle_flux_left, particle_flux_right, energy_flux_left, energy_flux_right]
+    - file: 'VOICEXX_profiles_${iter:06}.h5'
+      on_event: [profile_diagnostics]
+      collision_policy: replace_and_warn
+      write: [time_saved, density, mean_velocity, temperature, particle_flux, heat_flux]
   #trace: ~
 )PDI_CFG";
@@ -3,10 +3,10 @@
 #include <chrono>
 #include <cmath>
 #include <cstdlib>
-#include <filesystem>
-#include <fstream>
 #include <iostream>
-#include <string_view>
+#include <numeric>
+#include <optional>
+#include <string>
 
 #include <ddc/ddc.hpp>
 
@@ -18,6 +18,7 @@
 #include <paraconf.h>
 #include <pdi.h>
 
+#include "async_pdi_writer.hpp"
 #include "bsl_advection_vx.hpp"
 #include "bsl_advection_x.hpp"
 #include "fftpoissonsolver.hpp"
@@ -26,15 +27,13 @@
 #include "params.yaml.hpp"
 #include "pdi_out.yml.hpp"
 #include "predcorr.hpp"
+#include "simulation_io.hpp"
 #include "singlemodeperturbinitialization.hpp"
 //#include "species_info.hpp"
 #include "spline_interpolator.hpp"
-#include "splitvlasovsolver.hpp"
+#include "transposedsplitvlasovsolver.hpp"
 
-using std::cerr;
-using std::endl;
 using std::chrono::steady_clock;
-namespace fs = std::filesystem;
 
 using PreallocatableSplineInterpolatorX
         = PreallocatableSplineInterpolator<IDimX, BSplinesX, SplineXBoundary, SplineXBoundary>;
@@ -50,8 +49,8 @@ using PreallocatableSplineInterpolatorVy = PreallocatableSplineInterpolator<
         BSplinesVy,
         BoundCond::HERMITE,
         BoundCond::HERMITE>;
-using BslAdvectionX = BslAdvectionSpatial<GeometryXYVxVy, IDimX>;
-using BslAdvectionY = BslAdvectionSpatial<GeometryXYVxVy, IDimY>;
+using BslAdvectionX = BslAdvectionSpatial<GeometryVxVyXY, IDimX>;
+using BslAdvectionY = BslAdvectionSpatial<GeometryVxVyXY, IDimY>;
 using BslAdvectionVx = BslAdvectionVelocity<GeometryXYVxVy, IDimVx>;
 using BslAdvectionVy = BslAdvectionVelocity<GeometryXYVxVy, IDimVy>;
 
@@ -60,17 +59,10 @@ int main(int argc, char** argv)
     ddc::ScopeGuard scope(argc, argv);
 
     PC_tree_t conf_voicexx;
-    if (argc == 2) {
-        conf_voicexx = PC_parse_path(fs::path(argv[1]).c_str());
-    } else if (argc == 3) {
-        if (argv[1] == std::string_view("--dump-config")) {
-            std::fstream file(argv[2], std::fstream::out);
-            file << params_yaml;
-            return EXIT_SUCCESS;
-        }
-    } else {
-        cerr << "usage: " << argv[0] << " [--dump-config] <config_file.yml>" << endl;
-        return EXIT_FAILURE;
+    std::string restart_file;
+    if (std::optional<int> const exit_status
+        = parse_executable_arguments(conf_voicexx, restart_file, argc, argv, params_yaml)) {
+        return *exit_status;
     }
     PC_errhandler(PC_NULL_HANDLER);
 
@@ -193,7 +185,6 @@ int main(int argc, char** argv)
             init(allfequilibrium,
                  ddc::discrete_space<IDimSp>().perturb_modes(),
                  ddc::discrete_space<IDimSp>().perturb_amplitudes());
-    init(allfdistribu);
 
     // --> Algorithm info
     double const deltat = PCpp_double(conf_voicexx, ".Algorithm.deltat");
@@ -202,6 +193,11 @@ int main(int argc, char** argv)
     // --> Output info
     double const time_diag = PCpp_double(conf_voicexx, ".Output.time_diag");
     int const nbstep_diag = int(time_diag / deltat);
+    // checkpoints are only written if their period is given
+    bool const checkpoint
+            = PC_status(PCpp_get(conf_voicexx, ".Output.time_checkpoint")) == PC_OK;
+    int const nbstep_checkpoint
+            = read_nbstep(conf_voicexx, ".Output.time_checkpoint", deltat, nbiter + 1);
 
     PC_tree_t conf_pdi = PC_parse_string(PDI_CFG);
 
@@ -236,27 +232,29 @@ int main(int argc, char** argv)
             g_null_boundary_2d<BSplinesX, BSplinesY>,
             g_null_boundary_2d<BSplinesX, BSplinesY>);
 
-    SplineVxVyEvaluator const spline_vxvy_evaluator(
-            g_null_boundary_2d<BSplinesVx, BSplinesVy>,
-            g_null_boundary_2d<BSplinesVx, BSplinesVy>,
-            g_null_boundary_2d<BSplinesVx, BSplinesVy>,
-            g_null_boundary_2d<BSplinesVx, BSplinesVy>);
-
     // Create advection operator
     BslAdvectionX const advection_x(spline_x_interpolator);
     BslAdvectionY const advection_y(spline_y_interpolator);
     BslAdvectionVx const advection_vx(spline_vx_interpolator);
     BslAdvectionVy const advection_vy(spline_vy_interpolator);
 
-    SplitVlasovSolver const vlasov(advection_x, advection_y, advection_vx, advection_vy);
+    TransposedSplitVlasovSolver const vlasov(
+            meshSpXYVxVy,
+            advection_x,
+            advection_y,
+            advection_vx,
+            advection_vy);
 
     ddc::init_fourier_space<RDimX, RDimY>(ddc::select<IDimX, IDimY>(meshSpXYVxVy));
 
-    FftPoissonSolver const
-            poisson(builder_xy, spline_xy_evaluator, builder_vxvy, spline_vxvy_evaluator);
+    FftPoissonSolver const poisson(builder_xy, spline_xy_evaluator, builder_vxvy);
 
-    // Create predcorr operator
-    PredCorr const predcorr(vlasov, poisson);
+    // Create predcorr operator, the outputs are written while the next iterations are computed
+    // (the iterations needed by the checkpoints are also copied)
+    int const nbstep_output = checkpoint ? std::gcd(nbstep_diag, nbstep_checkpoint) : nbstep_diag;
+    AsyncPdiWriter<IDomainSpXYVxVy, IDomainXY>
+            output(meshSpXYVxVy, ddc::select<IDimX, IDimY>(meshSpXYVxVy), nbstep_output);
+    PredCorr const predcorr(vlasov, poisson, output);
 
     // Creating of mesh for output saving
     IDomainX const gridx = ddc::select<IDimX>(meshSpXYVxVy);
@@ -289,14 +287,18 @@ int main(int argc, char** argv)
     ddc::expose_to_pdi("MeshVx", meshVx_coord);
     ddc::expose_to_pdi("MeshVy", meshVy_coord);
     ddc::expose_to_pdi("nbstep_diag", nbstep_diag);
+    ddc::expose_to_pdi("nbstep_checkpoint", nbstep_checkpoint);
     ddc::expose_to_pdi("Nkinspecies", nb_kinspecies.value());
     ddc::expose_to_pdi("fdistribu_charges", ddc::discrete_space<IDimSp>().charges()[dom_kinsp]);
     ddc::expose_to_pdi("fdistribu_masses", ddc::discrete_space<IDimSp>().masses()[dom_kinsp]);
     ddc::PdiEvent("initial_state").with("fdistribu_eq", allfequilibrium);
 
+    int const iter_start = initialize_or_restart(restart_file, allfdistribu, init);
+
     steady_clock::time_point const start = steady_clock::now();
 
-    predcorr(allfdistribu, deltat, nbiter);
+    predcorr(allfdistribu, deltat, nbiter - iter_start, iter_start);
+    output.flush();
 
     steady_clock::time_point const end = steady_clock::now();
 
@@ -9,7 +9,11 @@ metadata:
   iter : int
   time_saved : double
   nbstep_diag: int
+  nbstep_checkpoint: int
+  restart_file_size: int
+  restart_file: { type: array, subtype: char, size: '$restart_file_size' }
   iter_saved : int
+  iter_start: int
   MeshX_extents: { type: array, subtype: int64, size: 1 }
   MeshX:
     type: array
@@ -48,6 +52,7 @@ metadata:
     size: [ '$fdistribu_eq_extents[0]', '$fdistribu_eq_extents[1]', '$fdistribu_eq_extents[2]' ]
 
 data:
+  iter_restart: int
   fdistribu_extents: { type: array, subtype: int64, size: 5 }
   fdistribu:
     type: array
@@ -79,6 +84,27 @@ plugins:
       on_event: [iteration, last_iteration]
       when: '${iter} % ${nbstep_diag} = 0'
       collision_policy: replace_and_warn
+      # the type of each variable in the file, HDF5 converts the data on write.
+      # fdistribu is stored in single precision and compressed, one chunk per velocity grid so
+      # that the chunks stay small and the distribution function at a point is read at once.
+      # Use `subtype: double` and remove `deflate` to store it as in memory.
+      datasets:
+        fdistribu:
+          type: array
+          subtype: float
+          size: [ '$fdistribu_extents[0]', '$fdistribu_extents[1]', '$fdistribu_extents[2]', '$fdistribu_extents[3]', '$fdistribu_extents[4]' ]
+          chunking: [ 1, 1, 1, '$fdistribu_extents[3]', '$fdistribu_extents[4]' ]
+          deflate: 1
       write: [time_saved, fdistribu, electrostatic_potential]
+    - file: 'VOICEXX_checkpoint_${iter:06}.h5'
+      on_event: [iteration]
+      when: '${iter} > ${iter_start} & ${iter} % ${nbstep_checkpoint} = 0'
+      collision_policy: replace_and_warn
+      write: [iter, time_saved, fdistribu]
+    - file: '${restart_file}'
+      on_event: [restart]
+      read:
+        iter_restart: { dataset: iter }
+        fdistribu: ~
   #trace: ~
 )PDI_CFG";
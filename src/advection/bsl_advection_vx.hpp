@@ -2,6 +2,10 @@
 
 #pragma once
 
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+
 #include <ddc/ddc.hpp>
 
 #include <i_interpolator.hpp>
@@ -9,15 +13,31 @@
 
 #include "iadvectionvx.hpp"
 
-template <class Geometry, class DDimV>
+/**
+ * @brief A semi-Lagrangian advection operator along a velocity dimension.
+ *
+ * With ExecPolicy = ddc::parallel_host_policy the lines are distributed over the threads of
+ * the Kokkos host execution space. The grid of the first spatial dimension is cut in one
+ * block per thread and each thread owns its own interpolator and its own buffer for the feet.
+ */
+template <class Geometry, class DDimV, class ExecPolicy = ddc::serial_host_policy>
 class BslAdvectionVelocity : public IAdvectionVelocity<Geometry, DDimV>
 {
     using DDimSp = typename Geometry::DDimSp;
     using FdistribuDDom = typename Geometry::FdistribuDDom;
     using SpatialDDom = typename Geometry::SpatialDDom;
-    using DElemV = ddc::DiscreteElement<DDimV>;
     using DElemSp = ddc::DiscreteElement<DDimSp>;
-    using CDimV = typename DDimV::continuous_dimension_type;
+
+    // A dimension used to index the blocks of work
+    struct DDimBlock
+    {
+    };
+
+    template <class DDim0, class... DDims>
+    static DDim0 first_dim(ddc::DiscreteDomain<DDim0, DDims...>);
+
+    // The dimension along which the work is cut in blocks, it is the outermost spatial dimension
+    using DDimSplit = decltype(first_dim(std::declval<SpatialDDom>()));
 
 private:
     IPreallocatableInterpolator<DDimV> const& m_interpolator_v;
@@ -39,42 +59,58 @@ public:
         ddc::DiscreteDomain<DDimV> const v_dom = ddc::select<DDimV>(dom);
         ddc::DiscreteDomain<DDimSp> const sp_dom = ddc::select<DDimSp>(dom);
 
-        // pre-allocate some memory to prevent allocation later in loop
-        ddc::Chunk<ddc::Coordinate<CDimV>, ddc::DiscreteDomain<DDimV>> feet_coords(v_dom);
-        ddc::Chunk<double, ddc::DiscreteDomain<DDimV>> contiguous_slice(v_dom);
-        std::unique_ptr<IInterpolator<DDimV>> const interpolator_v_ptr
-                = m_interpolator_v.preallocate();
-        IInterpolator<DDimV> const& interpolator_v = *interpolator_v_ptr;
-
         SpatialDDom const spatial_dom(allfdistribu.domain());
 
         auto c_dom = ddc::remove_dims_of(
                 ddc::remove_dims_of(ddc::remove_dims_of(dom, sp_dom), spatial_dom),
                 v_dom);
         using DElemC = typename decltype(c_dom)::discrete_element_type;
-        using DElemSpatial = typename SpatialDDom::discrete_element_type;
-
-        ddc::for_each(c_dom, [&](DElemC const ic) {
-            ddc::for_each(sp_dom, [&](DElemSp const isp) {
-                double const sqrt_me_on_mspecies = std::sqrt(mass(ielec()) / mass(isp));
 
-                ddc::for_each(spatial_dom, [&](DElemSpatial const ix) {
-                    // compute the displacement
-                    double const dvx = charge(isp) * sqrt_me_on_mspecies * dt * electric_field(ix);
+        using DElemSpatial = typename SpatialDDom::discrete_element_type;
 
-                    // compute the coordinates of the feet
-                    ddc::for_each(v_dom, [&](DElemV const iv) {
-                        feet_coords(iv) = ddc::Coordinate<CDimV>(ddc::coordinate(iv) - dvx);
+        // the outermost spatial grid is cut in blocks which are handled independently
+        ddc::DiscreteDomain<DDimSplit> const split_dom = ddc::select<DDimSplit>(dom);
+        std::size_t n_blocks = 1;
+        if constexpr (std::is_same_v<ExecPolicy, ddc::parallel_host_policy>) {
+            n_blocks = std::clamp<std::size_t>(
+                    Kokkos::DefaultHostExecutionSpace().concurrency(),
+                    1,
+                    split_dom.size());
+        }
+        ddc::DiscreteDomain<DDimBlock> const
+                block_dom(ddc::DiscreteElement<DDimBlock>(0), ddc::DiscreteVector<DDimBlock>(n_blocks));
+
+        ddc::for_each(ExecPolicy(), block_dom, [&](ddc::DiscreteElement<DDimBlock> const iblock) {
+            std::size_t const ib = (iblock - block_dom.front()).value();
+            std::size_t const split_begin = ib * split_dom.size() / n_blocks;
+            std::size_t const split_end = (ib + 1) * split_dom.size() / n_blocks;
+            ddc::DiscreteDomain<DDimSplit> const split_block(
+                    split_dom.front() + ddc::DiscreteVector<DDimSplit>(split_begin),
+                    ddc::DiscreteVector<DDimSplit>(split_end - split_begin));
+            // the lines along v of all the spatial points of the block are interpolated together
+            SpatialDDom const spatial_block = spatial_dom.restrict(split_block);
+
+            // pre-allocate some memory to prevent allocation later in loop
+            ddc::Chunk<double, SpatialDDom> displacements(spatial_block);
+            std::unique_ptr<IInterpolator<DDimV>> const interpolator_v_ptr
+                    = m_interpolator_v.preallocate();
+            IInterpolator<DDimV> const& interpolator_v = *interpolator_v_ptr;
+
+            ddc::for_each(c_dom, [&](DElemC const ic) {
+                ddc::for_each(sp_dom, [&](DElemSp const isp) {
+                    double const sqrt_me_on_mspecies = std::sqrt(mass(ielec()) / mass(isp));
+
+                    // compute the displacement of each line along v
+                    ddc::for_each(spatial_block, [&](DElemSpatial const ix) {
+                        displacements(ix)
+                                = charge(isp) * sqrt_me_on_mspecies * dt * electric_field(ix);
                     });
 
-                    // copy the slice in contiguous memory
-                    ddc::deepcopy(contiguous_slice, allfdistribu[ic][isp][ix]);
-
-                    // build a spline representation of the data
-                    interpolator_v(contiguous_slice, feet_coords.span_cview());
-
-                    // copy back
-                    ddc::deepcopy(allfdistribu[ic][isp][ix], contiguous_slice);
+                    // interpolate the function at the feet, which the provided interpolator
+                    // computes from the displacements while evaluating
+                    interpolator_v(
+                            allfdistribu[ic][isp][split_block],
+                            displacements.span_cview());
                 });
             });
         });
@@ -2,6 +2,9 @@
 
 #pragma once
 
+#include <algorithm>
+#include <type_traits>
+
 #include <ddc/ddc.hpp>
 
 #include <i_interpolator.hpp>
@@ -9,17 +12,27 @@
 
 #include "iadvectionx.hpp"
 
-template <class Geometry, class DDimX>
+/**
+ * @brief A semi-Lagrangian advection operator along a spatial dimension.
+ *
+ * With ExecPolicy = ddc::parallel_host_policy the lines are distributed over the threads of
+ * the Kokkos host execution space. The velocity grid is cut in one block per thread and each
+ * thread owns its own interpolator and its own buffer for the feet.
+ */
+template <class Geometry, class DDimX, class ExecPolicy = ddc::serial_host_policy>
 class BslAdvectionSpatial : public IAdvectionSpatial<Geometry, DDimX>
 {
     using DDimSp = typename Geometry::DDimSp;
     using DDimV = typename Geometry::template velocity_dim_for<DDimX>;
     using DDom = typename Geometry::FdistribuDDom;
-    using DElemX = ddc::DiscreteElement<DDimX>;
     using DElemV = ddc::DiscreteElement<DDimV>;
     using DElemSp = ddc::DiscreteElement<DDimSp>;
     using DElemSpV = ddc::DiscreteElement<DDimSp, DDimV>;
-    using CDimX = typename DDimX::continuous_dimension_type;
+
+    // A dimension used to index the blocks of work
+    struct DDimBlock
+    {
+    };
 
 private:
     IPreallocatableInterpolator<DDimX> const& m_interpolator_x;
@@ -41,39 +54,48 @@ public:
         ddc::DiscreteDomain<DDimV> const v_dom = ddc::select<DDimV>(dom);
         ddc::DiscreteDomain<DDimSp> const sp_dom = ddc::select<DDimSp>(dom);
 
-        // pre-allocate some memory to prevent allocation later in loop
-        ddc::Chunk<ddc::Coordinate<CDimX>, ddc::DiscreteDomain<DDimX>> feet_coords(x_dom);
-        ddc::Chunk<double, ddc::DiscreteDomain<DDimX>> contiguous_slice(x_dom);
-        std::unique_ptr<IInterpolator<DDimX>> const interpolator_x_ptr
-                = m_interpolator_x.preallocate();
-        IInterpolator<DDimX> const& interpolator_x = *interpolator_x_ptr;
-
         auto c_dom = ddc::remove_dims_of(
                 dom,
                 ddc::DiscreteDomain<DDimSp, DDimX, DDimV>(sp_dom, x_dom, v_dom));
         using DElemC = typename decltype(c_dom)::discrete_element_type;
 
-        ddc::for_each(c_dom, [&](DElemC const ic) {
-            ddc::for_each(sp_dom, [&](DElemSp const isp) {
-                double const sqrt_me_on_mspecies = std::sqrt(mass(ielec()) / mass(isp));
-
-                ddc::for_each(v_dom, [&](DElemV const iv) {
-                    // compute the displacement
-                    double const dx = sqrt_me_on_mspecies * dt * ddc::coordinate(iv);
-
-                    // compute the coordinates of the feet
-                    ddc::for_each(x_dom, [&](DElemX const ix) {
-                        feet_coords(ix) = ddc::Coordinate<CDimX>(ddc::coordinate(ix) - dx);
+        // the velocity grid is cut in blocks which are handled independently
+        std::size_t n_blocks = 1;
+        if constexpr (std::is_same_v<ExecPolicy, ddc::parallel_host_policy>) {
+            n_blocks = std::clamp<std::size_t>(
+                    Kokkos::DefaultHostExecutionSpace().concurrency(),
+                    1,
+                    v_dom.size());
+        }
+        ddc::DiscreteDomain<DDimBlock> const
+                block_dom(ddc::DiscreteElement<DDimBlock>(0), ddc::DiscreteVector<DDimBlock>(n_blocks));
+
+        ddc::for_each(ExecPolicy(), block_dom, [&](ddc::DiscreteElement<DDimBlock> const iblock) {
+            std::size_t const ib = (iblock - block_dom.front()).value();
+            std::size_t const v_begin = ib * v_dom.size() / n_blocks;
+            std::size_t const v_end = (ib + 1) * v_dom.size() / n_blocks;
+            ddc::DiscreteDomain<DDimV> const v_block(
+                    v_dom.front() + ddc::DiscreteVector<DDimV>(v_begin),
+                    ddc::DiscreteVector<DDimV>(v_end - v_begin));
+
+            // pre-allocate some memory to prevent allocation later in loop
+            ddc::Chunk<double, ddc::DiscreteDomain<DDimV>> displacements(v_block);
+            std::unique_ptr<IInterpolator<DDimX>> const interpolator_x_ptr
+                    = m_interpolator_x.preallocate();
+            IInterpolator<DDimX> const& interpolator_x = *interpolator_x_ptr;
+
+            ddc::for_each(c_dom, [&](DElemC const ic) {
+                ddc::for_each(sp_dom, [&](DElemSp const isp) {
+                    double const sqrt_me_on_mspecies = std::sqrt(mass(ielec()) / mass(isp));
+
+                    // compute the displacement of each line along x
+                    ddc::for_each(v_block, [&](DElemV const iv) {
+                        displacements(iv) = sqrt_me_on_mspecies * dt * ddc::coordinate(iv);
                     });
 
-                    // copy the slice in contiguous memory
-                    ddc::deepcopy(contiguous_slice, allfdistribu[ic][isp][iv]);
-
-                    // interpolate the function at the feet using the provided interpolator
-                    interpolator_x(contiguous_slice, feet_coords.span_cview());
-
-                    // copy back
-                    ddc::deepcopy(allfdistribu[ic][isp][iv], contiguous_slice);
+                    // interpolate the function at the feet, which the provided interpolator
+                    // computes from the displacements while evaluating
+                    interpolator_x(allfdistribu[ic][isp][v_block], displacements.span_cview());
                 });
             });
         });
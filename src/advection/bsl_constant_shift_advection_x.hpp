@@ -0,0 +1,306 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <complex>
+#include <vector>
+
+#include <ddc/ddc.hpp>
+
+#include <sll/spline_builder.hpp>
+#include <sll/view.hpp>
+
+#include <fftw3.h>
+#include <species_info.hpp>
+
+#include "iadvectionx.hpp"
+
+/**
+ * @brief A semi-Lagrangian advection operator along a periodic spatial dimension discretised
+ * with uniform B-splines.
+ *
+ * The displacement only depends on the species and on the velocity. As the interpolation
+ * points are uniformly spaced and periodic, the interpolation followed by the evaluation at the
+ * feet is a circulant operator on each line: the spline coefficients are the convolution of the
+ * values with the inverse of the periodic interpolation matrix, and all the feet are found at
+ * the same offset in their cell, so the values at the feet are a convolution of these
+ * coefficients with the degree+1 values of the B-splines at this offset. The discrete Fourier
+ * transform of the first column of this operator is computed once per (species, velocity) for a
+ * given time step and reused as long as the time step is unchanged. A step then costs a forward
+ * and a backward real transform of all the lines of each (x, v) plane and no spline solve.
+ *
+ * The Fourier coefficients, the FFTW plans and the spectral buffer are cached in the operator
+ * and updated inside the const operator() without synchronisation, so an instance must not be
+ * called concurrently from several threads.
+ */
+template <class Geometry, class DDimX, class BSplines>
+class BslConstantShiftAdvectionSpatial : public IAdvectionSpatial<Geometry, DDimX>
+{
+    using DDimSp = typename Geometry::DDimSp;
+    using DDimV = typename Geometry::template velocity_dim_for<DDimX>;
+    using DDom = typename Geometry::FdistribuDDom;
+    using DElemSp = ddc::DiscreteElement<DDimSp>;
+    using DElemSpV = ddc::DiscreteElement<DDimSp, DDimV>;
+    using DDomSpV = ddc::DiscreteDomain<DDimSp, DDimV>;
+    using CDimX = typename DDimX::continuous_dimension_type;
+    using Stencil = std::array<double, BSplines::degree() + 1>;
+
+    static_assert(BSplines::is_periodic(), "The constant shift advection requires periodic splines");
+    static_assert(BSplines::is_uniform(), "The constant shift advection requires uniform splines");
+
+private:
+    SplineBuilder<BSplines, DDimX, BoundCond::PERIODIC, BoundCond::PERIODIC> const& m_builder;
+
+    // The time step and the domain for which the Fourier coefficients were computed
+    mutable double m_symbol_dt;
+
+    mutable DDomSpV m_symbol_dom;
+
+    // The Fourier coefficients of the non-negative modes of the operator of each
+    // (species, velocity), divided by the number of points to normalise the backward transform
+    mutable std::vector<std::complex<double>> m_symbols;
+
+    // The number of lines of a (x, v) plane and the strides of x and v for which the transforms
+    // were planned
+    mutable std::array<std::size_t, 3> m_plan_layout;
+
+    // The Fourier coefficients of the lines of a (x, v) plane, aligned by FFTW
+    mutable fftw_complex* m_lines_hat;
+
+    mutable fftw_plan m_forward_plan;
+
+    mutable fftw_plan m_backward_plan;
+
+public:
+    /**
+     * @brief Create a constant shift advection operator.
+     * @param[in] builder An operator which builds spline coefficients from the values of a function at the interpolation points.
+     */
+    explicit BslConstantShiftAdvectionSpatial(
+            SplineBuilder<BSplines, DDimX, BoundCond::PERIODIC, BoundCond::PERIODIC> const&
+                    builder)
+        : m_builder(builder)
+        , m_symbol_dt(std::nan(""))
+        , m_plan_layout {0, 0, 0}
+        , m_lines_hat(nullptr)
+        , m_forward_plan(nullptr)
+        , m_backward_plan(nullptr)
+    {
+    }
+
+    BslConstantShiftAdvectionSpatial(BslConstantShiftAdvectionSpatial const& x) = delete;
+
+    BslConstantShiftAdvectionSpatial(BslConstantShiftAdvectionSpatial&& x) = delete;
+
+    ~BslConstantShiftAdvectionSpatial() override
+    {
+        destroy_plans();
+    }
+
+    BslConstantShiftAdvectionSpatial& operator=(BslConstantShiftAdvectionSpatial const& x)
+            = delete;
+
+    BslConstantShiftAdvectionSpatial& operator=(BslConstantShiftAdvectionSpatial&& x) = delete;
+
+    ddc::ChunkSpan<double, DDom> operator()(
+            ddc::ChunkSpan<double, DDom> const allfdistribu,
+            double const dt) const override
+    {
+        DDom const dom = allfdistribu.domain();
+        ddc::DiscreteDomain<DDimX> const x_dom = ddc::select<DDimX>(dom);
+        ddc::DiscreteDomain<DDimV> const v_dom = ddc::select<DDimV>(dom);
+        ddc::DiscreteDomain<DDimSp> const sp_dom = ddc::select<DDimSp>(dom);
+        assert(x_dom == m_builder.interpolation_domain());
+
+        auto c_dom = ddc::remove_dims_of(
+                dom,
+                ddc::DiscreteDomain<DDimSp, DDimX, DDimV>(sp_dom, x_dom, v_dom));
+        using DElemC = typename decltype(c_dom)::discrete_element_type;
+
+        DDomSpV const spv_dom(sp_dom, v_dom);
+        if (dt != m_symbol_dt || spv_dom != m_symbol_dom) {
+            compute_symbols(spv_dom, x_dom, dt);
+        }
+
+        std::size_t const nkx = x_dom.size() / 2 + 1;
+        std::size_t const nv = v_dom.size();
+
+        ddc::for_each(c_dom, [&](DElemC const ic) {
+            ddc::for_each(sp_dom, [&](DElemSp const isp) {
+                auto const plane = allfdistribu[ic][isp];
+                std::array<std::size_t, 3> const layout {
+                        nv,
+                        std::size_t(plane.template stride<DDimX>()),
+                        std::size_t(plane.template stride<DDimV>())};
+                if (layout != m_plan_layout) {
+                    plan_transforms(layout, x_dom.size(), plane.data_handle());
+                }
+
+                fftw_execute_dft_r2c(m_forward_plan, plane.data_handle(), m_lines_hat);
+
+                // apply the operator of each line in Fourier space
+                std::complex<double>* const lines_hat
+                        = reinterpret_cast<std::complex<double>*>(m_lines_hat);
+                std::complex<double> const* const symbols
+                        = m_symbols.data() + (isp - sp_dom.front()).value() * nv * nkx;
+                for (std::size_t i = 0; i < nv * nkx; ++i) {
+                    lines_hat[i] *= symbols[i];
+                }
+
+                fftw_execute_dft_c2r(m_backward_plan, m_lines_hat, plane.data_handle());
+            });
+        });
+
+        return allfdistribu;
+    }
+
+private:
+    void compute_symbols(
+            DDomSpV const& spv_dom,
+            ddc::DiscreteDomain<DDimX> const& x_dom,
+            double const dt) const
+    {
+        std::size_t const nx = x_dom.size();
+        std::size_t const nkx = nx / 2 + 1;
+        std::size_t const nspv = spv_dom.size();
+        assert(nx == ddc::discrete_space<BSplines>().ncells());
+        m_symbol_dt = dt;
+        m_symbol_dom = spv_dom;
+
+        // the spline coefficients of the function which is 1 at the first point and 0 at the
+        // others, i.e. the first column of the inverse of the interpolation matrix
+        ddc::Chunk<double, ddc::DiscreteDomain<DDimX>> impulse(x_dom);
+        ddc::fill(impulse, 0.);
+        impulse(x_dom.front()) = 1.;
+        ddc::Chunk<double, ddc::DiscreteDomain<BSplines>> impulse_coefs(m_builder.spline_domain());
+        m_builder(impulse_coefs.span_view(), impulse.span_cview());
+        double const* const coefs = impulse_coefs.data_handle();
+
+        double* const columns = fftw_alloc_real(nspv * nx);
+        fftw_complex* const columns_hat = fftw_alloc_complex(nspv * nkx);
+        int const n = nx;
+        fftw_plan const plan = fftw_plan_many_dft_r2c(
+                1,
+                &n,
+                nspv,
+                columns,
+                nullptr,
+                1,
+                nx,
+                columns_hat,
+                nullptr,
+                1,
+                nkx,
+                FFTW_ESTIMATE);
+
+        double const rmin = ddc::discrete_space<BSplines>().rmin();
+        double const length = ddc::discrete_space<BSplines>().length();
+        double const x0 = ddc::coordinate(x_dom.front());
+
+        std::size_t l = 0;
+        ddc::for_each(spv_dom, [&](DElemSpV const ispv) {
+            DElemSp const isp = ddc::select<DDimSp>(ispv);
+            double const sqrt_me_on_mspecies = std::sqrt(mass(ielec()) / mass(isp));
+            // compute the displacement
+            double const dx = sqrt_me_on_mspecies * dt * ddc::coordinate(ddc::select<DDimV>(ispv));
+
+            // compute the coordinate of the foot of the first point inside the domain
+            double foot = x0 - dx;
+            foot -= std::floor((foot - rmin) / length) * length;
+            if (foot >= rmin + length) {
+                foot = rmin;
+            }
+
+            Stencil stencil;
+            std::size_t j = ddc::discrete_space<BSplines>()
+                                    .eval_basis(as_span(stencil), ddc::Coordinate<CDimX>(foot))
+                                    .uid();
+
+            // the values at the feet of the function which is 1 at the first point
+            double* const column = columns + l * nx;
+            for (std::size_t i = 0; i < nx; ++i, ++j) {
+                // the last coefficients are copies of the first ones so only the index of the
+                // first B-spline needs to be wrapped
+                if (j == nx) {
+                    j = 0;
+                }
+                double y = 0.;
+                for (std::size_t k = 0; k < stencil.size(); ++k) {
+                    y += stencil[k] * coefs[j + k];
+                }
+                column[i] = y;
+            }
+            ++l;
+        });
+
+        fftw_execute(plan);
+        m_symbols.resize(nspv * nkx);
+        std::complex<double> const* const symbols_hat
+                = reinterpret_cast<std::complex<double> const*>(columns_hat);
+        for (std::size_t i = 0; i < nspv * nkx; ++i) {
+            m_symbols[i] = symbols_hat[i] / double(nx);
+        }
+
+        fftw_destroy_plan(plan);
+        fftw_free(columns_hat);
+        fftw_free(columns);
+    }
+
+    void plan_transforms(
+            std::array<std::size_t, 3> const& layout,
+            std::size_t const nx,
+            double* const data) const
+    {
+        destroy_plans();
+        m_plan_layout = layout;
+        std::size_t const nkx = nx / 2 + 1;
+        auto const [nv, stride_x, stride_v] = layout;
+        m_lines_hat = fftw_alloc_complex(nv * nkx);
+
+        // FFTW_ESTIMATE does not overwrite the arrays and the planes are not aligned alike
+        int const n = nx;
+        m_forward_plan = fftw_plan_many_dft_r2c(
+                1,
+                &n,
+                nv,
+                data,
+                nullptr,
+                stride_x,
+                stride_v,
+                m_lines_hat,
+                nullptr,
+                1,
+                nkx,
+                FFTW_ESTIMATE | FFTW_UNALIGNED);
+        m_backward_plan = fftw_plan_many_dft_c2r(
+                1,
+                &n,
+                nv,
+                m_lines_hat,
+                nullptr,
+                1,
+                nkx,
+                data,
+                nullptr,
+                stride_x,
+                stride_v,
+                FFTW_ESTIMATE | FFTW_UNALIGNED);
+    }
+
+    void destroy_plans() const
+    {
+        if (m_backward_plan) {
+            fftw_destroy_plan(m_backward_plan);
+        }
+        if (m_forward_plan) {
+            fftw_destroy_plan(m_forward_plan);
+        }
+        fftw_free(m_lines_hat);
+        m_backward_plan = nullptr;
+        m_forward_plan = nullptr;
+        m_lines_hat = nullptr;
+    }
+};
@@ -0,0 +1,216 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include <Eigen/IterativeLinearSolvers>
+#include <Eigen/Sparse>
+#ifdef VOICEXX_CHOLMOD_SUPPORT
+#include <Eigen/CholmodSupport>
+#endif
+
+/// The solvers available for the linear system of the polar finite element Poisson solver.
+enum class PolarLinearSolverType {
+    /// A direct solver for small systems and an iterative solver for large ones.
+    Automatic,
+    /// A sparse Cholesky factorisation.
+    Cholesky,
+    /// A conjugate gradient preconditioned by the blocks of the rings of B-splines.
+    ConjugateGradient
+};
+
+/**
+ * @brief An interface for the solvers of the symmetric positive definite linear system of the
+ * polar finite element Poisson solver.
+ */
+class IPolarLinearSolver
+{
+public:
+    using SparseMatrix = Eigen::SparseMatrix<double>;
+
+    virtual ~IPolarLinearSolver() = default;
+
+    /**
+     * @brief Prepare the solver for a matrix (factorisation or preconditioner set up).
+     * @param[in] matrix The matrix of the linear system.
+     */
+    virtual void compute(SparseMatrix const& matrix) = 0;
+
+    /**
+     * @brief Solve the linear system for a right-hand side.
+     * @param[in] b The right-hand side.
+     * @return The solution of the linear system.
+     */
+    virtual Eigen::VectorXd solve(Eigen::VectorXd const& b) const = 0;
+};
+
+/**
+ * @brief A direct solver using a sparse Cholesky factorisation.
+ *
+ * The supernodal factorisation of CHOLMOD is used when it is available, otherwise the
+ * simplicial LDL^T factorisation of Eigen with an approximate minimum degree ordering.
+ */
+class PolarCholeskySolver : public IPolarLinearSolver
+{
+#ifdef VOICEXX_CHOLMOD_SUPPORT
+    Eigen::CholmodSupernodalLLT<SparseMatrix> m_factorisation;
+#else
+    Eigen::SimplicialLDLT<SparseMatrix> m_factorisation;
+#endif
+
+public:
+    void compute(SparseMatrix const& matrix) override
+    {
+        m_factorisation.compute(matrix);
+        if (m_factorisation.info() != Eigen::Success) {
+            throw std::runtime_error("The factorisation of the polar Poisson matrix failed.");
+        }
+    }
+
+    Eigen::VectorXd solve(Eigen::VectorXd const& b) const override
+    {
+        return m_factorisation.solve(b);
+    }
+};
+
+/**
+ * @brief A block Jacobi preconditioner whose blocks are contiguous ranges of unknowns.
+ *
+ * For the polar Poisson matrix the blocks are the B-splines covering the singular point and
+ * each ring of B-splines with the same radial index. A block couples all the poloidal
+ * B-splines of a ring, so the preconditioner solves the poloidal part of the operator exactly
+ * and only the radial coupling is left to the iterative method. Each block is a periodic
+ * banded matrix whose sparse factorisation costs O(nbasis_p * degree^2).
+ *
+ * The interface is the one expected by the iterative solvers of Eigen.
+ */
+class RingBlockJacobiPreconditioner
+{
+    using SparseMatrix = Eigen::SparseMatrix<double>;
+
+    using BlockFactorisation = Eigen::SimplicialLDLT<SparseMatrix>;
+
+    std::vector<Eigen::Index> m_block_starts;
+
+    std::vector<std::unique_ptr<BlockFactorisation>> m_blocks;
+
+    Eigen::ComputationInfo m_info;
+
+public:
+    RingBlockJacobiPreconditioner() : m_info(Eigen::Success) {}
+
+    /**
+     * @brief Set the blocks of the preconditioner.
+     * @param[in] block_starts The index of the first unknown of each block followed by the
+     *            number of unknowns.
+     */
+    void set_block_starts(std::vector<Eigen::Index> const& block_starts)
+    {
+        m_block_starts = block_starts;
+    }
+
+    template <class MatrixType>
+    RingBlockJacobiPreconditioner& analyzePattern(MatrixType const&)
+    {
+        return *this;
+    }
+
+    template <class MatrixType>
+    RingBlockJacobiPreconditioner& factorize(MatrixType const& matrix)
+    {
+        // Without blocks the preconditioner is the identity
+        m_blocks.clear();
+        m_info = Eigen::Success;
+        for (std::size_t i = 0; i + 1 < m_block_starts.size(); ++i) {
+            Eigen::Index const start = m_block_starts[i];
+            Eigen::Index const size = m_block_starts[i + 1] - start;
+            SparseMatrix const block = matrix.block(start, start, size, size);
+            m_blocks.push_back(std::make_unique<BlockFactorisation>(block));
+            if (m_blocks.back()->info() != Eigen::Success) {
+                m_info = Eigen::NumericalIssue;
+            }
+        }
+        return *this;
+    }
+
+    template <class MatrixType>
+    RingBlockJacobiPreconditioner& compute(MatrixType const& matrix)
+    {
+        return factorize(matrix);
+    }
+
+    template <class Rhs>
+    Eigen::VectorXd solve(Eigen::MatrixBase<Rhs> const& b) const
+    {
+        if (m_blocks.empty()) {
+            return b;
+        }
+        Eigen::VectorXd x(b.size());
+        for (std::size_t i = 0; i < m_blocks.size(); ++i) {
+            Eigen::Index const start = m_block_starts[i];
+            Eigen::Index const size = m_block_starts[i + 1] - start;
+            x.segment(start, size) = m_blocks[i]->solve(b.segment(start, size));
+        }
+        return x;
+    }
+
+    Eigen::ComputationInfo info() const
+    {
+        return m_info;
+    }
+};
+
+/**
+ * @brief An iterative solver using the conjugate gradient method preconditioned by the
+ * ring block Jacobi preconditioner.
+ *
+ * Only the matrix and the factorisations of the blocks are stored, which keeps the memory
+ * linear in the number of unknowns for large grids.
+ */
+class PolarConjugateGradientSolver : public IPolarLinearSolver
+{
+    Eigen::ConjugateGradient<
+            SparseMatrix,
+            Eigen::Lower | Eigen::Upper,
+            RingBlockJacobiPreconditioner>
+            m_solver;
+
+public:
+    /**
+     * @brief Create the iterative solver.
+     * @param[in] block_starts The index of the first unknown of each block of the
+     *            preconditioner followed by the number of unknowns.
+     * @param[in] tolerance The tolerance on the relative residual.
+     * @param[in] max_iterations The maximum number of iterations.
+     */
+    PolarConjugateGradientSolver(
+            std::vector<Eigen::Index> const& block_starts,
+            double const tolerance,
+            Eigen::Index const max_iterations)
+    {
+        m_solver.preconditioner().set_block_starts(block_starts);
+        m_solver.setTolerance(tolerance);
+        m_solver.setMaxIterations(max_iterations);
+    }
+
+    void compute(SparseMatrix const& matrix) override
+    {
+        m_solver.compute(matrix);
+        if (m_solver.info() != Eigen::Success) {
+            throw std::runtime_error("The preconditioner of the polar Poisson matrix failed.");
+        }
+    }
+
+    Eigen::VectorXd solve(Eigen::VectorXd const& b) const override
+    {
+        Eigen::VectorXd x = m_solver.solve(b);
+        if (m_solver.info() != Eigen::Success) {
+            throw std::runtime_error("The conjugate gradient of the polar Poisson solver did not "
+                                     "converge.");
+        }
+        return x;
+    }
+};
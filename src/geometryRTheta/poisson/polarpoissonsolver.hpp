@@ -1,6 +1,9 @@
 #pragma once
 
 #include <iomanip>
+#include <memory>
+#include <type_traits>
+#include <vector>
 
 #include <ddc/ddc.hpp>
 
@@ -12,6 +15,8 @@
 
 #include <Eigen/Sparse>
 
+#include "polarlinearsolver.hpp"
+
 //#include "chargedensitycalculator.hpp"
 //#include "ipoissonsolver.hpp"
 
@@ -87,6 +92,12 @@ private:
     static constexpr int n_gauss_legendre_p = BSplinesP::degree() + 1;
     static constexpr int n_overlap_cells = PolarBSplines::continuity + 1;
 
+    // The largest system solved with a direct solver when the solver is chosen automatically
+    static constexpr int max_direct_solver_size = 200000;
+
+    // The tolerance on the relative residual of the iterative solver
+    static constexpr double iterative_solver_tolerance = 1e-12;
+
     static constexpr ddc::DiscreteVector<RBasisSubset> n_non_zero_bases_r
             = ddc::DiscreteVector<RBasisSubset>(BSplinesR::degree() + 1);
     static constexpr ddc::DiscreteVector<PBasisSubset> n_non_zero_bases_p
@@ -125,16 +136,28 @@ private:
 
     ddc::Chunk<double, QuadratureDomainRP> int_volume;
 
+    // The values of the RHS times the integral volume at each Gauss-Legendre point
+    mutable ddc::Chunk<double, QuadratureDomainRP> m_rhs_quad_values;
+
     PolarSplineEvaluator<PolarBSplines> m_polar_spline_evaluator;
 
-    Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>> m_matrix;
+    std::unique_ptr<IPolarLinearSolver> m_linear_solver;
 
 public:
+    /**
+     * @brief Assemble the finite element matrix and prepare its linear solver.
+     * @param[in] coeff_alpha The spline representation of the coefficient alpha.
+     * @param[in] coeff_beta The spline representation of the coefficient beta.
+     * @param[in] mapping The mapping from the logical to the physical domain.
+     * @param[in] solver_type The linear solver, by default a direct solver for systems of at
+     *            most max_direct_solver_size unknowns and an iterative solver otherwise.
+     */
     template <class Mapping>
     PolarSplineFEMPoissonSolver(
             ddc::ChunkSpan<double const, ddc::DiscreteDomain<BSplinesR, BSplinesP>> coeff_alpha,
             ddc::ChunkSpan<double const, ddc::DiscreteDomain<BSplinesR, BSplinesP>> coeff_beta,
-            Mapping const& mapping)
+            Mapping const& mapping,
+            PolarLinearSolverType const solver_type = PolarLinearSolverType::Automatic)
         : nbasis_r(ddc::discrete_space<BSplinesR>().nbasis() - n_overlap_cells - 1)
         , nbasis_p(ddc::discrete_space<BSplinesP>().nbasis())
         , fem_non_singular_domain(
@@ -171,6 +194,7 @@ public:
                                   PBasisSubset,
                                   QDimPMesh>(non_zero_bases_p, quadrature_domain_p))
         , int_volume(QuadratureDomainRP(quadrature_domain_r, quadrature_domain_p))
+        , m_rhs_quad_values(QuadratureDomainRP(quadrature_domain_r, quadrature_domain_p))
         , m_polar_spline_evaluator(g_polar_null_boundary_2d<PolarBSplines>)
     {
         const std::size_t ncells_r = ddc::discrete_space<BSplinesR>().ncells();
@@ -485,20 +509,87 @@ public:
         });
         matrix.setFromTriplets(matrix_elements.begin(), matrix_elements.end());
         assert(matrix_idx == n_elements_singular + n_elements_overlap + n_elements_stencil);
-        m_matrix.compute(matrix);
+        m_linear_solver = make_linear_solver(solver_type, n_matrix_size);
+        m_linear_solver->compute(matrix);
     }
 
-    template <class RHSFunction, class Domain>
+    /**
+     * @brief Solve the Poisson equation for a RHS given as a function.
+     *
+     * The RHS is evaluated once at each Gauss-Legendre point.
+     *
+     * @param[in] rhs The RHS, a callable taking a coordinate (r, theta).
+     * @param[in] coords_eval The coordinates where the solution is evaluated.
+     * @param[out] result The values of the solution at coords_eval.
+     */
+    template <
+            class RHSFunction,
+            class Domain,
+            std::enable_if_t<
+                    std::is_invocable_r_v<double, RHSFunction const&, ddc::Coordinate<DimR, DimP>>,
+                    int> = 0>
     void operator()(
             RHSFunction const& rhs,
             ddc::ChunkSpan<ddc::Coordinate<DimR, DimP> const, Domain> const coords_eval,
             ddc::ChunkSpan<double, Domain> result) const
     {
-        Eigen::VectorXd b(
+        ddc::for_each(m_rhs_quad_values.domain(), [&](QuadratureMeshRP const irp) {
+            QuadratureMeshR const ir = ddc::select<QDimRMesh>(irp);
+            QuadratureMeshP const ip = ddc::select<QDimPMesh>(irp);
+            ddc::Coordinate<DimR, DimP> coord(get_coordinate(ir), get_coordinate(ip));
+            m_rhs_quad_values(irp) = rhs(coord) * int_volume(ir, ip);
+        });
+        solve_with_rhs_quad_values(coords_eval, result);
+    }
+
+    /**
+     * @brief Solve the Poisson equation for a RHS given as a spline on the 2D B-splines.
+     *
+     * The spline is evaluated at the Gauss-Legendre points with the B-spline values computed
+     * in the constructor, no spline evaluator is needed.
+     *
+     * @param[in] rhs_spline The spline coefficients of the RHS.
+     * @param[in] coords_eval The coordinates where the solution is evaluated.
+     * @param[out] result The values of the solution at coords_eval.
+     */
+    template <class Domain>
+    void operator()(
+            ddc::ChunkSpan<double const, ddc::DiscreteDomain<BSplinesR, BSplinesP>> rhs_spline,
+            ddc::ChunkSpan<ddc::Coordinate<DimR, DimP> const, Domain> const coords_eval,
+            ddc::ChunkSpan<double, Domain> result) const
+    {
+        ddc::for_each(m_rhs_quad_values.domain(), [&](QuadratureMeshRP const irp) {
+            QuadratureMeshR const ir = ddc::select<QDimRMesh>(irp);
+            QuadratureMeshP const ip = ddc::select<QDimPMesh>(irp);
+            // The B-splines which are non-zero in the cell start at the index of the cell
+            const int cell_idx_r(ir.uid() / n_gauss_legendre_r);
+            const int cell_idx_p(ip.uid() / n_gauss_legendre_p);
+            double value = 0.0;
+            for (auto ib_r : non_zero_bases_r) {
+                const ddc::DiscreteElement<BSplinesR> r_idx(cell_idx_r + ib_r.uid());
+                double const rb = r_basis_vals_and_derivs(ib_r, ir).value;
+                for (auto ib_p : non_zero_bases_p) {
+                    const ddc::DiscreteElement<BSplinesP> p_idx(cell_idx_p + ib_p.uid());
+                    double const pb = p_basis_vals_and_derivs(ib_p, ip).value;
+                    value += rhs_spline(r_idx, p_idx) * rb * pb;
+                }
+            }
+            m_rhs_quad_values(irp) = value * int_volume(ir, ip);
+        });
+        solve_with_rhs_quad_values(coords_eval, result);
+    }
+
+private:
+    template <class Domain>
+    void solve_with_rhs_quad_values(
+            ddc::ChunkSpan<ddc::Coordinate<DimR, DimP> const, Domain> const coords_eval,
+            ddc::ChunkSpan<double, Domain> result) const
+    {
+        Eigen::VectorXd b = Eigen::VectorXd::Zero(
                 ddc::discrete_space<PolarBSplines>().nbasis()
                 - ddc::discrete_space<BSplinesP>().nbasis());
 
-        // Fill b
+        // Fill b for the bsplines which cover the singular point
         ddc::for_each(PolarBSplines::singular_domain(), [&](IDimPolarBspl const idx) {
             b(idx.uid()) = ddc::transform_reduce(
                     quadrature_domain_singular,
@@ -507,67 +598,37 @@ public:
                     [&](QuadratureMeshRP const quad_idx) {
                         QuadratureMeshR const ir = ddc::select<QDimRMesh>(quad_idx);
                         QuadratureMeshP const ip = ddc::select<QDimPMesh>(quad_idx);
-                        ddc::Coordinate<DimR, DimP> coord(get_coordinate(ir), get_coordinate(ip));
-                        return rhs(coord) * singular_basis_vals_and_derivs(idx, ir, ip).value
-                               * int_volume(ir, ip);
+                        return m_rhs_quad_values(quad_idx)
+                               * singular_basis_vals_and_derivs(idx, ir, ip).value;
                     });
         });
-        const std::size_t ncells_r = ddc::discrete_space<BSplinesR>().ncells();
-        ddc::for_each(fem_non_singular_domain, [&](IDimPolarBspl const idx) {
-            const IDimBSpline2D idx_2d(PolarBSplines::get_2d_index(idx));
-            const std::size_t r_idx(ddc::select<BSplinesR>(idx_2d).uid());
-            const std::size_t p_idx(ddc::select<BSplinesP>(idx_2d).uid());
-
-            // Find the cells on which the bspline is non-zero
-            int first_cell_r(r_idx - BSplinesR::degree());
-            int first_cell_p(p_idx - BSplinesP::degree());
-            std::size_t last_cell_r(r_idx + 1);
-            if (first_cell_r < 0)
-                first_cell_r = 0;
-            if (last_cell_r > ncells_r)
-                last_cell_r = ncells_r;
-            ddc::DiscreteVector<RCellDim> const r_length(last_cell_r - first_cell_r);
-            ddc::DiscreteVector<PCellDim> const p_length(BSplinesP::degree() + 1);
-
-
-            ddc::DiscreteElement<RCellDim> const start_r(first_cell_r);
-            ddc::DiscreteElement<PCellDim> const start_p(pmod(first_cell_p));
-            const ddc::DiscreteDomain<RCellDim> r_cells(start_r, r_length);
-            const ddc::DiscreteDomain<PCellDim> p_cells(start_p, p_length);
-            const ddc::DiscreteDomain<RCellDim, PCellDim> non_zero_cells(r_cells, p_cells);
-            assert(r_length * p_length > 0);
-            double element = 0.0;
-            ddc::for_each(non_zero_cells, [&](CellIndex const cell_idx) {
-                const int cell_idx_r(ddc::select<RCellDim>(cell_idx).uid());
-                const int cell_idx_p(pmod(ddc::select<PCellDim>(cell_idx).uid()));
-
-                const QuadratureDomainRP cell_quad_points(
-                        get_quadrature_points_in_cell(cell_idx_r, cell_idx_p));
-
-                // Find the column where the non-zero data is stored
-                ddc::DiscreteElement<RBasisSubset> ib_r(r_idx - cell_idx_r);
-                ddc::DiscreteElement<PBasisSubset> ib_p(pmod(p_idx - cell_idx_p));
 
-                // Calculate the weak integral
-                element += ddc::transform_reduce(
-                        cell_quad_points,
-                        0.0,
-                        ddc::reducer::sum<double>(),
-                        [&](QuadratureMeshRP const quad_idx) {
-                            QuadratureMeshR const ir = ddc::select<QDimRMesh>(quad_idx);
-                            QuadratureMeshP const ip = ddc::select<QDimPMesh>(quad_idx);
-                            ddc::Coordinate<DimR, DimP>
-                                    coord(get_coordinate(ir), get_coordinate(ip));
-                            double rb = r_basis_vals_and_derivs(ib_r, ir).value;
-                            double pb = p_basis_vals_and_derivs(ib_p, ip).value;
-                            return rhs(coord) * rb * pb * int_volume(ir, ip);
-                        });
-            });
-            b(idx.uid()) = element;
+        // Fill b for the other bsplines by adding the contribution of each Gauss-Legendre
+        // point to the bsplines which are non-zero at this point. The last radial bsplines
+        // are excluded, their coefficients are fixed by the Dirichlet boundary condition.
+        ddc::for_each(m_rhs_quad_values.domain(), [&](QuadratureMeshRP const irp) {
+            QuadratureMeshR const ir = ddc::select<QDimRMesh>(irp);
+            QuadratureMeshP const ip = ddc::select<QDimPMesh>(irp);
+            const int cell_idx_r(ir.uid() / n_gauss_legendre_r);
+            const int cell_idx_p(ip.uid() / n_gauss_legendre_p);
+            for (auto ib_r : non_zero_bases_r) {
+                const int r_idx(cell_idx_r + ib_r.uid());
+                if (r_idx < n_overlap_cells || r_idx >= n_overlap_cells + nbasis_r) {
+                    continue;
+                }
+                double const rhs_r
+                        = m_rhs_quad_values(irp) * r_basis_vals_and_derivs(ib_r, ir).value;
+                for (auto ib_p : non_zero_bases_p) {
+                    const int p_idx(pmod(cell_idx_p + ib_p.uid()));
+                    const IDimPolarBspl idx(
+                            PolarBSplines::get_polar_index(IDimBSpline2D(r_idx, p_idx)));
+                    b(idx.uid()) += rhs_r * p_basis_vals_and_derivs(ib_p, ip).value;
+                }
+            }
         });
 
         // Solve the matrix equation
-        Eigen::VectorXd x = m_matrix.solve(b);
+        Eigen::VectorXd x = m_linear_solver->solve(b);
 
         ddc::DiscreteDomain<BSplinesR, BSplinesP> non_singular_2d_domain(
                 radial_bsplines.remove_last(ddc::DiscreteVector<BSplinesR> {1}),
@@ -608,7 +669,33 @@ public:
         m_polar_spline_evaluator(result, coords_eval, spline);
     }
 
-private:
+    std::unique_ptr<IPolarLinearSolver> make_linear_solver(
+            PolarLinearSolverType solver_type,
+            int const n_matrix_size) const
+    {
+        if (solver_type == PolarLinearSolverType::Automatic) {
+            solver_type = n_matrix_size <= max_direct_solver_size
+                                  ? PolarLinearSolverType::Cholesky
+                                  : PolarLinearSolverType::ConjugateGradient;
+        }
+        if (solver_type == PolarLinearSolverType::Cholesky) {
+            return std::make_unique<PolarCholeskySolver>();
+        }
+
+        // The unknowns are ordered as the B-splines covering the singular point followed by
+        // the rings of nbasis_p B-splines, which are the blocks of the preconditioner
+        std::vector<Eigen::Index> block_starts {0};
+        for (int start = PolarBSplines::n_singular_basis(); start < n_matrix_size;
+             start += nbasis_p) {
+            block_starts.push_back(start);
+        }
+        block_starts.push_back(n_matrix_size);
+        return std::make_unique<PolarConjugateGradientSolver>(
+                block_starts,
+                iterative_solver_tolerance,
+                n_matrix_size);
+    }
+
     static QuadratureDomainRP get_quadrature_points_in_cell(int cell_idx_r, int cell_idx_p)
     {
         const QuadratureMeshR first_quad_point_r(cell_idx_r * n_gauss_legendre_r);
@@ -5,28 +5,27 @@
 #include <ddc/ddc.hpp>
 
 #include <sll/spline_builder.hpp>
-#include <sll/spline_evaluator.hpp>
 
 #include <geometry.hpp>
-
+#include <quadrature.hpp>
+
+/**
+ * @brief A class which computes the charge density from the distribution function.
+ *
+ * The charge density is the integral over the velocity of the spline interpolation of the
+ * distribution function. This integral is a linear function of the values of the distribution
+ * function, so it is computed with quadrature coefficients obtained once from the spline builder.
+ */
 class ChargeDensityCalculator
 {
-    SplineVxBuilder const& m_spline_vx_builder;
-
-    SplineEvaluator<BSplinesVx> m_spline_vx_evaluator;
-
-    std::vector<double> m_derivs_vxmin_data;
-
-    Span1D<double> m_derivs_vxmin;
-
-    std::vector<double> m_derivs_vxmax_data;
-
-    Span1D<double> m_derivs_vxmax;
+    Quadrature<IDimVx> m_quadrature;
 
 public:
-    ChargeDensityCalculator(
-            SplineVxBuilder const& spline_vx_builder,
-            SplineEvaluator<BSplinesVx> const& spline_vx_evaluator);
+    /**
+     * @brief Create a ChargeDensityCalculator.
+     * @param[in] spline_vx_builder The builder used to interpolate the distribution function along vx.
+     */
+    explicit ChargeDensityCalculator(SplineVxBuilder const& spline_vx_builder);
 
     void operator()(DSpanX rho, DViewSpXVx allfdistribu) const;
 };
@@ -1,10 +1,11 @@
 // SPDX-License-Identifier: MIT
 
+#include <cassert>
+
 #include <ddc/ddc.hpp>
 
 #include <sll/gauss_legendre_integration.hpp>
 #include <sll/matrix.hpp>
-#include <sll/null_boundary_value.hpp>
 
 #include <geometry.hpp>
 #include <species_info.hpp>
@@ -14,14 +15,12 @@
 namespace {
 
 //===========================================================================
-// Create a non-uniform spline evaluator from the provided evaluator
+// Initialise the non-uniform B-splines with the knots of the B-splines along x
 //===========================================================================
-template <class BSplines>
-SplineEvaluator<NUBSplinesX> jit_build_nubsplinesx(
-        SplineEvaluator<BSplines> const& spline_x_evaluator)
+NUBSDomainX jit_build_nubsplinesx()
 {
-    static_assert(std::is_same_v<BSplines, UBSplinesX> || std::is_same_v<BSplines, NUBSplinesX>);
-    if constexpr (std::is_same_v<BSplines, UBSplinesX>) {
+    static_assert(std::is_same_v<BSplinesX, UBSplinesX> || std::is_same_v<BSplinesX, NUBSplinesX>);
+    if constexpr (std::is_same_v<BSplinesX, UBSplinesX>) {
         int const ncells = ddc::discrete_space<UBSplinesX>().ncells();
         std::vector<CoordX> knots(ncells + 1);
 
@@ -29,12 +28,8 @@ SplineEvaluator<NUBSplinesX> jit_build_nubsplinesx(
             knots[i] = CoordX(ddc::discrete_space<UBSplinesX>().get_knot(i));
         }
         ddc::init_discrete_space<NUBSplinesX>(knots);
-        // Boundary values are never evaluated
-        return SplineEvaluator<
-                NUBSplinesX>(g_null_boundary<NUBSplinesX>, g_null_boundary<NUBSplinesX>);
-    } else {
-        return spline_x_evaluator;
     }
+    return ddc::discrete_space<NUBSplinesX>().full_domain();
 }
 
 } // namespace
@@ -44,18 +39,21 @@ SplineEvaluator<NUBSplinesX> jit_build_nubsplinesx(
 //===========================================================================
 FemNonPeriodicPoissonSolver::FemNonPeriodicPoissonSolver(
         SplineXBuilder const& spline_x_builder,
-        SplineEvaluator<BSplinesX> const& spline_x_evaluator,
-        SplineVxBuilder const& spline_vx_builder,
-        SplineEvaluator<BSplinesVx> const& spline_vx_evaluator)
+        [[maybe_unused]] SplineEvaluator<BSplinesX> const& spline_x_evaluator,
+        SplineVxBuilder const& spline_vx_builder)
     : m_spline_x_builder(spline_x_builder)
-    , m_spline_x_evaluator(spline_x_evaluator)
-    , m_spline_x_nu_evaluator(jit_build_nubsplinesx(spline_x_evaluator))
-    , m_compute_rho(spline_vx_builder, spline_vx_evaluator)
+    , m_compute_rho(spline_vx_builder)
     , m_nbasis(ddc::discrete_space<BSplinesX>().nbasis())
     , m_ncells(ddc::discrete_space<BSplinesX>().ncells())
     , m_quad_coef(ddc::DiscreteDomain<QMeshX>(
               ddc::DiscreteElement<QMeshX>(0),
               ddc::DiscreteVector<QMeshX>(s_npts_gauss * m_ncells)))
+    , m_eval_jmin(spline_x_builder.interpolation_domain())
+    , m_eval_values(spline_x_builder.interpolation_domain())
+    , m_eval_derivs(spline_x_builder.interpolation_domain())
+    , m_rho(spline_x_builder.interpolation_domain())
+    , m_rho_spline_coef(spline_x_builder.spline_domain())
+    , m_phi_spline_coef(jit_build_nubsplinesx())
 {
     static_assert(!SplineXBuilder::bsplines_type::is_periodic());
     BSDomainX const
@@ -78,6 +76,10 @@ FemNonPeriodicPoissonSolver::FemNonPeriodicPoissonSolver(
 
     // Build the finite elements matrix
     build_matrix();
+
+    // Cache the B-spline values used by each solve
+    build_rhs_matrix();
+    build_evaluation_matrices();
 }
 
 //===========================================================================
@@ -123,6 +125,43 @@ void FemNonPeriodicPoissonSolver::build_matrix()
     m_fem_matrix->factorize();
 }
 
+//===========================================================================
+// Construct the matrix mapping the spline coefficients of rho to the RHS
+//===========================================================================
+void FemNonPeriodicPoissonSolver::build_rhs_matrix()
+{
+    m_rhs_matrix.assign(m_nbasis, BandedRow {});
+
+    // M(i, j) = \int b_i(x) b_j(x) dx is stored in the column j-i+degree of the row i
+    std::array<double, s_degree + 1> values_ptr;
+    DSpan1D const values(values_ptr.data(), values_ptr.size());
+    ddc::for_each(m_quad_coef.domain(), [&](ddc::DiscreteElement<QMeshX> const ix) {
+        ddc::Coordinate<RDimX> const coord = coord_from_quad_point(ddc::coordinate(ix));
+        ddc::DiscreteElement<BSplinesX> const jmin
+                = ddc::discrete_space<BSplinesX>().eval_basis(values, coord);
+        for (int j = 0; j < s_degree + 1; ++j) {
+            int const j_idx = jmin.uid() + j;
+            for (int k = 0; k < s_degree + 1; ++k) {
+                m_rhs_matrix[j_idx][k - j + s_degree] += values(j) * values(k) * m_quad_coef(ix);
+            }
+        }
+    });
+}
+
+//===========================================================================
+// Evaluate the B-splines and their derivatives at the interpolation points
+//===========================================================================
+void FemNonPeriodicPoissonSolver::build_evaluation_matrices()
+{
+    ddc::for_each(m_eval_jmin.domain(), [&](IndexX const ix) {
+        DSpan1D const values(m_eval_values(ix).data(), s_degree + 1);
+        DSpan1D const derivs(m_eval_derivs(ix).data(), s_degree + 1);
+        m_eval_jmin(ix)
+                = ddc::discrete_space<NUBSplinesX>().eval_basis(values, ddc::coordinate(ix)).uid();
+        ddc::discrete_space<NUBSplinesX>().eval_deriv(derivs, ddc::coordinate(ix));
+    });
+}
+
 
 //===========================================================================
 //               Solve the Poisson equation
@@ -131,31 +170,25 @@ void FemNonPeriodicPoissonSolver::solve_matrix_system(
         ddc::ChunkSpan<double, NUBSDomainX> const phi_spline_coef,
         ddc::ChunkSpan<double, BSDomainX> const rho_spline_coef) const
 {
-    std::array<double, s_degree + 1> values_ptr;
-    DSpan1D const values(values_ptr.data(), values_ptr.size());
-
-    for (int i(0); i < m_nbasis; ++i) {
-        phi_spline_coef(ddc::DiscreteElement<NUBSplinesX>(i)) = 0.0;
-    }
+    phi_spline_coef(ddc::DiscreteElement<NUBSplinesX>(0)) = 0.0;
+    phi_spline_coef(ddc::DiscreteElement<NUBSplinesX>(m_nbasis - 1)) = 0.0;
 
     int const rhs_size = m_nbasis - 2;
     DSpan1D const phi_rhs(phi_spline_coef.data_handle() + 1, rhs_size);
 
-    // Fill phi_rhs(i) with \int rho(x) b_i(x) dx
+    // Fill phi_rhs(i) with \int rho(x) b_i(x) dx = sum_j M(i, j) rho_j
     // Rk: phi_rhs no longer contains spline coefficients, but is the
     //     RHS of the matrix equation
-    ddc::for_each(m_quad_coef.domain(), [&](ddc::DiscreteElement<QMeshX> const ix) {
-        ddc::Coordinate<RDimX> const coord = coord_from_quad_point(ddc::coordinate(ix));
-        ddc::DiscreteElement<BSplinesX> const jmin
-                = ddc::discrete_space<BSplinesX>().eval_basis(values, coord);
-        double const rho_val = m_spline_x_evaluator(coord, rho_spline_coef);
-        for (int j = 0; j < s_degree + 1; ++j) {
-            int const j_idx = (jmin.uid() + j) % m_nbasis - 1;
-            if (j_idx != -1 && j_idx != rhs_size) {
-                phi_rhs(j_idx) += rho_val * values(j) * m_quad_coef(ix);
+    for (int i = 1; i < m_nbasis - 1; ++i) {
+        double rhs = 0.;
+        for (int k = 0; k < 2 * s_degree + 1; ++k) {
+            int const j_idx = i + k - s_degree;
+            if (j_idx >= 0 && j_idx < m_nbasis) {
+                rhs += m_rhs_matrix[i][k] * rho_spline_coef(ddc::DiscreteElement<BSplinesX>(j_idx));
             }
         }
-    });
+        phi_rhs(i - 1) = rhs;
+    }
 
     // Solve the matrix equation to find the spline coefficients of phi
     m_fem_matrix->solve_inplace(phi_rhs);
@@ -184,22 +217,29 @@ void FemNonPeriodicPoissonSolver::operator()(
         DViewSpXVx const allfdistribu) const
 {
     assert(electrostatic_potential.domain() == ddc::get_domain<IDimX>(allfdistribu));
+    assert(electrostatic_potential.domain() == m_rho.domain());
     IDomainX const dom_x = electrostatic_potential.domain();
 
     // Compute the RHS of the Poisson equation
-    ddc::Chunk<double, IDomainX> rho(dom_x);
-    m_compute_rho(rho, allfdistribu);
+    m_compute_rho(m_rho, allfdistribu);
 
     //
-    ddc::Chunk<double, BSDomainX> rho_spline_coef(m_spline_x_builder.spline_domain());
-    m_spline_x_builder(rho_spline_coef, rho);
-    ddc::Chunk<double, NUBSDomainX> phi_spline_coef(
-            ddc::discrete_space<NUBSplinesX>().full_domain());
-    solve_matrix_system(phi_spline_coef, rho_spline_coef);
+    m_spline_x_builder(m_rho_spline_coef, m_rho);
+    solve_matrix_system(m_phi_spline_coef, m_rho_spline_coef);
 
-    //
+    // Evaluate phi and its derivative with the cached B-spline values
     ddc::for_each(dom_x, [&](IndexX const ix) {
-        electrostatic_potential(ix) = m_spline_x_nu_evaluator(ddc::coordinate(ix), phi_spline_coef);
-        electric_field(ix) = -m_spline_x_nu_evaluator.deriv(ddc::coordinate(ix), phi_spline_coef);
+        BasisValues const& values = m_eval_values(ix);
+        BasisValues const& derivs = m_eval_derivs(ix);
+        double phi = 0.;
+        double dphi = 0.;
+        for (int j = 0; j < s_degree + 1; ++j) {
+            double const coef
+                    = m_phi_spline_coef(ddc::DiscreteElement<NUBSplinesX>(m_eval_jmin(ix) + j));
+            phi += values[j] * coef;
+            dphi += derivs[j] * coef;
+        }
+        electrostatic_potential(ix) = phi;
+        electric_field(ix) = -dphi;
     });
 }
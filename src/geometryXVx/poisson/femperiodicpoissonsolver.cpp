@@ -14,17 +14,21 @@
 
 FemPeriodicPoissonSolver::FemPeriodicPoissonSolver(
         SplineXBuilder const& spline_x_builder,
-        SplineEvaluator<BSplinesX> const& spline_x_evaluator,
-        SplineVxBuilder const& spline_vx_builder,
-        SplineEvaluator<BSplinesVx> const& spline_vx_evaluator)
+        [[maybe_unused]] SplineEvaluator<BSplinesX> const& spline_x_evaluator,
+        SplineVxBuilder const& spline_vx_builder)
     : m_spline_x_builder(spline_x_builder)
-    , m_spline_x_evaluator(spline_x_evaluator)
-    , m_compute_rho(spline_vx_builder, spline_vx_evaluator)
+    , m_compute_rho(spline_vx_builder)
     , m_nbasis(ddc::discrete_space<BSplinesX>().nbasis())
     , m_ncells(ddc::discrete_space<BSplinesX>().ncells())
     , m_quad_coef(ddc::DiscreteDomain<QMeshX>(
               ddc::DiscreteElement<QMeshX>(0),
               ddc::DiscreteVector<QMeshX>(s_npts_gauss * m_ncells)))
+    , m_eval_jmin(spline_x_builder.interpolation_domain())
+    , m_eval_values(spline_x_builder.interpolation_domain())
+    , m_eval_derivs(spline_x_builder.interpolation_domain())
+    , m_rho(spline_x_builder.interpolation_domain())
+    , m_rho_spline_coef(spline_x_builder.spline_domain())
+    , m_phi_spline_coef(spline_x_builder.spline_domain())
 {
     static_assert(SplineXBuilder::bsplines_type::is_periodic());
 
@@ -48,6 +52,10 @@ FemPeriodicPoissonSolver::FemPeriodicPoissonSolver(
 
     // Build the finite elements matrix
     build_matrix();
+
+    // Cache the B-spline values used by each solve
+    build_rhs_matrix();
+    build_evaluation_matrices();
 }
 
 
@@ -108,6 +116,46 @@ void FemPeriodicPoissonSolver::build_matrix()
 }
 
 
+//===========================================================================
+// Construct the matrix mapping the spline coefficients of rho to the RHS
+//===========================================================================
+void FemPeriodicPoissonSolver::build_rhs_matrix()
+{
+    m_rhs_matrix.assign(m_nbasis, BandedRow {});
+
+    // M(i, j) = \int b_i(x) b_j(x) dx is stored in the column j-i+degree of the row i,
+    // the indices being taken modulo the number of basis functions
+    std::array<double, s_degree + 1> values_ptr;
+    DSpan1D const values(values_ptr.data(), values_ptr.size());
+    ddc::for_each(m_quad_coef.domain(), [&](ddc::DiscreteElement<QMeshX> const ix) {
+        ddc::Coordinate<RDimX> const coord = coord_from_quad_point(ddc::coordinate(ix));
+        ddc::DiscreteElement<BSplinesX> const jmin
+                = ddc::discrete_space<BSplinesX>().eval_basis(values, coord);
+        for (int j = 0; j < s_degree + 1; ++j) {
+            int const j_idx = (jmin.uid() + j) % m_nbasis;
+            for (int k = 0; k < s_degree + 1; ++k) {
+                m_rhs_matrix[j_idx][k - j + s_degree] += values(j) * values(k) * m_quad_coef(ix);
+            }
+        }
+    });
+}
+
+
+//===========================================================================
+// Evaluate the B-splines and their derivatives at the interpolation points
+//===========================================================================
+void FemPeriodicPoissonSolver::build_evaluation_matrices()
+{
+    ddc::for_each(m_eval_jmin.domain(), [&](IndexX const ix) {
+        DSpan1D const values(m_eval_values(ix).data(), s_degree + 1);
+        DSpan1D const derivs(m_eval_derivs(ix).data(), s_degree + 1);
+        m_eval_jmin(ix)
+                = ddc::discrete_space<BSplinesX>().eval_basis(values, ddc::coordinate(ix)).uid();
+        ddc::discrete_space<BSplinesX>().eval_deriv(derivs, ddc::coordinate(ix));
+    });
+}
+
+
 //===========================================================================
 //               Solve the Poisson equation
 //---------------------------------------------------------------------------
@@ -115,28 +163,21 @@ void FemPeriodicPoissonSolver::solve_matrix_system(
         ddc::ChunkSpan<double, BSDomainX> const phi_spline_coef,
         ddc::ChunkSpan<double, BSDomainX> const rho_spline_coef) const
 {
-    std::array<double, s_degree + 1> values_ptr;
-    DSpan1D const values(values_ptr.data(), values_ptr.size());
-
     int const rhs_size = m_nbasis + 1;
     DSpan1D const phi_rhs(phi_spline_coef.data_handle(), rhs_size);
-    for (int i(0); i < rhs_size; ++i) {
-        phi_rhs(i) = 0.0;
-    }
 
-    // Fill phi_rhs(i) with \int rho(x) b_i(x) dx
+    // Fill phi_rhs(i) with \int rho(x) b_i(x) dx = sum_j M(i, j) rho_j
     // Rk: phi_rhs no longer contains spline coefficients, but is the
     //     RHS of the matrix equation
-    ddc::for_each(m_quad_coef.domain(), [&](ddc::DiscreteElement<QMeshX> const ix) {
-        ddc::Coordinate<RDimX> const coord = coord_from_quad_point(ddc::coordinate(ix));
-        ddc::DiscreteElement<BSplinesX> const jmin
-                = ddc::discrete_space<BSplinesX>().eval_basis(values, coord);
-        double const rho_val = m_spline_x_evaluator(coord, rho_spline_coef);
-        for (int j = 0; j < s_degree + 1; ++j) {
-            int const j_idx = (jmin.uid() + j) % m_nbasis;
-            phi_rhs(j_idx) = phi_rhs(j_idx) + rho_val * values(j) * m_quad_coef(ix);
+    for (int i = 0; i < m_nbasis; ++i) {
+        double rhs = 0.;
+        for (int k = 0; k < 2 * s_degree + 1; ++k) {
+            int const j_idx = (i + k - s_degree + m_nbasis) % m_nbasis;
+            rhs += m_rhs_matrix[i][k] * rho_spline_coef(ddc::DiscreteElement<BSplinesX>(j_idx));
         }
-    });
+        phi_rhs(i) = rhs;
+    }
+    phi_rhs(m_nbasis) = 0.;
 
     // Solve the matrix equation to find the spline coefficients of phi
     m_fem_matrix->solve_inplace(phi_rhs);
@@ -171,21 +212,29 @@ void FemPeriodicPoissonSolver::operator()(
         DViewSpXVx const allfdistribu) const
 {
     assert(electrostatic_potential.domain() == ddc::get_domain<IDimX>(allfdistribu));
+    assert(electrostatic_potential.domain() == m_rho.domain());
     IDomainX const dom_x = electrostatic_potential.domain();
 
     // Compute the RHS of the Poisson equation
-    ddc::Chunk<double, IDomainX> rho(dom_x);
-    m_compute_rho(rho, allfdistribu);
+    m_compute_rho(m_rho, allfdistribu);
 
     //
-    ddc::Chunk<double, BSDomainX> rho_spline_coef(m_spline_x_builder.spline_domain());
-    m_spline_x_builder(rho_spline_coef, rho);
-    ddc::Chunk<double, BSDomainX> phi_spline_coef(m_spline_x_builder.spline_domain());
-    solve_matrix_system(phi_spline_coef, rho_spline_coef);
+    m_spline_x_builder(m_rho_spline_coef, m_rho);
+    solve_matrix_system(m_phi_spline_coef, m_rho_spline_coef);
 
-    //
+    // Evaluate phi and its derivative with the cached B-spline values
     ddc::for_each(dom_x, [&](IndexX const ix) {
-        electrostatic_potential(ix) = m_spline_x_evaluator(ddc::coordinate(ix), phi_spline_coef);
-        electric_field(ix) = -m_spline_x_evaluator.deriv(ddc::coordinate(ix), phi_spline_coef);
+        BasisValues const& values = m_eval_values(ix);
+        BasisValues const& derivs = m_eval_derivs(ix);
+        double phi = 0.;
+        double dphi = 0.;
+        for (int j = 0; j < s_degree + 1; ++j) {
+            double const coef
+                    = m_phi_spline_coef(ddc::DiscreteElement<BSplinesX>(m_eval_jmin(ix) + j));
+            phi += values[j] * coef;
+            dphi += derivs[j] * coef;
+        }
+        electrostatic_potential(ix) = phi;
+        electric_field(ix) = -dphi;
     });
 }
@@ -2,6 +2,9 @@
 
 #pragma once
 
+#include <array>
+#include <vector>
+
 #include <sll/spline_builder.hpp>
 #include <sll/spline_evaluator.hpp>
 
@@ -27,11 +30,15 @@ private:
     // Gauss points used for integration computation
     static int constexpr s_npts_gauss = BSplinesX::degree() + 1;
 
+    // The values, or the derivatives, of the B-splines which are non-zero at a point
+    using BasisValues = std::array<double, s_degree + 1>;
+
+    // The coefficients of a row of a banded matrix, from the column i-degree to i+degree
+    using BandedRow = std::array<double, 2 * s_degree + 1>;
+
 private:
     SplineXBuilder const& m_spline_x_builder;
 
-    SplineEvaluator<BSplinesX> m_spline_x_evaluator;
-
     ChargeDensityCalculator m_compute_rho;
 
     // Number of spline basis in x direction
@@ -44,6 +51,25 @@ private:
 
     std::unique_ptr<Matrix> m_fem_matrix;
 
+    // The matrix of the \int b_i(x) b_j(x) dx, which maps the spline coefficients of rho to
+    // the RHS of the matrix equation, a row per test function
+    std::vector<BandedRow> m_rhs_matrix;
+
+    // The index of the first B-spline of phi which is non-zero at each interpolation point
+    ddc::Chunk<int, IDomainX> m_eval_jmin;
+
+    // The values of these B-splines at each interpolation point
+    ddc::Chunk<BasisValues, IDomainX> m_eval_values;
+
+    // The derivatives of these B-splines at each interpolation point
+    ddc::Chunk<BasisValues, IDomainX> m_eval_derivs;
+
+    mutable DFieldX m_rho;
+
+    mutable ddc::Chunk<double, BSDomainX> m_rho_spline_coef;
+
+    mutable ddc::Chunk<double, BSDomainX> m_phi_spline_coef;
+
 private:
     static ddc::Coordinate<QDimX> quad_point_from_coord(ddc::Coordinate<RDimX> const& coord)
     {
@@ -59,8 +85,7 @@ public:
     FemPeriodicPoissonSolver(
             SplineXBuilder const& spline_x_builder,
             SplineEvaluator<BSplinesX> const& spline_x_evaluator,
-            SplineVxBuilder const& spline_vx_builder,
-            SplineEvaluator<BSplinesVx> const& spline_vx_evaluator);
+            SplineVxBuilder const& spline_vx_builder);
 
     void operator()(DSpanX electrostatic_potential, DSpanX electric_field, DViewSpXVx allfdistribu)
             const override;
@@ -68,6 +93,10 @@ public:
 private:
     void build_matrix();
 
+    void build_rhs_matrix();
+
+    void build_evaluation_matrices();
+
     void solve_matrix_system(
             ddc::ChunkSpan<double, BSDomainX> phi_spline_coef,
             ddc::ChunkSpan<double, BSDomainX> rho_spline_coef) const;
@@ -2,17 +2,14 @@
 
 #include <cassert>
 #include <cmath>
-#include <complex>
-#include <iostream>
+#include <cstddef>
 
 #include <ddc/ddc.hpp>
-#include <ddc/kernels/fft.hpp>
 
-#include <sll/bsplines_uniform.hpp>
-#include <sll/null_boundary_value.hpp>
 #include <sll/spline_builder.hpp>
 #include <sll/spline_evaluator.hpp>
 
+#include <ddc_helper.hpp>
 #include <geometry.hpp>
 
 #include "fftpoissonsolver.hpp"
@@ -21,55 +18,102 @@ FftPoissonSolver::FftPoissonSolver(
         SplineXBuilder const& spline_x_builder,
         SplineEvaluator<BSplinesX> const& spline_x_evaluator,
         SplineVxBuilder const& spline_vx_builder,
-        SplineEvaluator<BSplinesVx> const& spline_vx_evaluator)
-    : m_compute_rho(spline_vx_builder, spline_vx_evaluator)
+        bool const spectral_electric_field,
+        std::string const& wisdom_file)
+    : m_compute_rho(spline_vx_builder)
     , m_electric_field(spline_x_builder, spline_x_evaluator)
+    , m_x_dom(spline_x_builder.interpolation_domain())
+    , m_spectral_electric_field(spectral_electric_field)
+    , m_field(nullptr)
+    , m_field_hat(nullptr)
+    , m_field_plan(nullptr)
 {
+    int const nx = m_x_dom.size();
+    int const nkx = nx / 2 + 1;
+    m_rho = fftw_alloc_real(nx);
+    m_rho_hat = fftw_alloc_complex(nkx);
+
+    // Solve Poisson's equation -d2Phi/dx2 = rho
+    //   in Fourier space as kx*kx*FFT(Phi)=FFT(rho)
+    // the factor 1/N normalises the backward transform
+    double const dk = 2. * M_PI / ddcHelper::total_interval_length(m_x_dom);
+    m_inv_k2.resize(nkx);
+    m_inv_k2[0] = 0.;
+    for (int ikx = 1; ikx < nkx; ++ikx) {
+        double const kx = ikx * dk;
+        m_inv_k2[ikx] = 1. / (kx * kx * nx);
+    }
+
+    // The derivative of the Nyquist mode of an even number of points is not defined
+    m_kx.resize(nkx);
+    for (int ikx = 0; ikx < nkx; ++ikx) {
+        m_kx[ikx] = (2 * ikx == nx) ? 0. : ikx * dk;
+    }
+
+    // FFTW_MEASURE overwrites the buffers, which are only filled by the solves
+    if (!wisdom_file.empty()) {
+        fftw_import_wisdom_from_filename(wisdom_file.c_str());
+    }
+    m_forward_plan = fftw_plan_dft_r2c_1d(nx, m_rho, m_rho_hat, FFTW_MEASURE);
+    m_backward_plan = fftw_plan_dft_c2r_1d(nx, m_rho_hat, m_rho, FFTW_MEASURE);
+    if (m_spectral_electric_field) {
+        m_field = fftw_alloc_real(nx);
+        m_field_hat = fftw_alloc_complex(nkx);
+        m_field_plan = fftw_plan_dft_c2r_1d(nx, m_field_hat, m_field, FFTW_MEASURE);
+    }
+    if (!wisdom_file.empty()) {
+        fftw_export_wisdom_to_filename(wisdom_file.c_str());
+    }
+}
+
+FftPoissonSolver::~FftPoissonSolver()
+{
+    if (m_field_plan) {
+        fftw_destroy_plan(m_field_plan);
+    }
+    fftw_free(m_field_hat);
+    fftw_free(m_field);
+    fftw_destroy_plan(m_backward_plan);
+    fftw_destroy_plan(m_forward_plan);
+    fftw_free(m_rho_hat);
+    fftw_free(m_rho);
 }
 
-// 1- Inner solvers shall be passed in the constructor
-// 2- Should it take an array of distribution functions ?
 void FftPoissonSolver::operator()(
         DSpanX const electrostatic_potential,
         DSpanX const electric_field,
         DViewSpXVx const allfdistribu) const
 {
     assert(electrostatic_potential.domain() == ddc::get_domain<IDimX>(allfdistribu));
-    IDomainX const x_dom = electrostatic_potential.domain();
+    assert(electrostatic_potential.domain() == m_x_dom);
 
     // Compute the RHS of the Poisson equation.
-    ddc::Chunk<double, IDomainX> rho(x_dom);
-    DFieldVx contiguous_slice_vx(allfdistribu.domain<IDimVx>());
+    DSpanX const rho(m_rho, m_x_dom);
     m_compute_rho(rho, allfdistribu);
 
-    // Build a mesh in the fourier space, for N points
-    IDomainFx const k_mesh = ddc::FourierMesh(x_dom, false);
+    // Compute FFT(rho), divide by N*kx*kx and transform back to get Phi
+    fftw_execute(m_forward_plan);
+    for (std::size_t ikx = 0; ikx < m_inv_k2.size(); ++ikx) {
+        m_rho_hat[ikx][0] *= m_inv_k2[ikx];
+        m_rho_hat[ikx][1] *= m_inv_k2[ikx];
+    }
 
-    ddc::Chunk<Kokkos::complex<double>, IDomainFx> intermediate_chunk
-            = ddc::Chunk(k_mesh, ddc::HostAllocator<Kokkos::complex<double>>());
+    // Compute efield = -dPhi/dx as the inverse FFT of -i*kx*FFT(Phi)
+    // before the backward transform of Phi, which overwrites its Fourier coefficients
+    if (m_spectral_electric_field) {
+        for (std::size_t ikx = 0; ikx < m_kx.size(); ++ikx) {
+            m_field_hat[ikx][0] = m_kx[ikx] * m_rho_hat[ikx][1];
+            m_field_hat[ikx][1] = -m_kx[ikx] * m_rho_hat[ikx][0];
+        }
+        fftw_execute(m_field_plan);
+        ddc::deepcopy(electric_field, DSpanX(m_field, m_x_dom));
+    }
 
-    // Compute FFT(rho)
-    ddc::FFT_Normalization norm = ddc::FFT_Normalization::BACKWARD;
-    ddc::
-            fft(Kokkos::DefaultHostExecutionSpace(),
-                intermediate_chunk.span_view(),
-                rho.span_view(),
-                ddc::kwArgs_fft {norm});
-
-    // Solve Poisson's equation -d2Phi/dx2 = rho
-    //   in Fourier space as -kx*kx*FFT(Phi)=FFT(rho))
-    intermediate_chunk(k_mesh.front()) = 0.;
-    ddc::for_each(k_mesh.remove_first(IVectFx(1)), [&](IndexFx const ikx) {
-        intermediate_chunk(ikx) = intermediate_chunk(ikx) / (coordinate(ikx) * coordinate(ikx));
-    });
-
-    // Perform the inverse 1D FFT of the solution to deduce the electrostatic potential
-    ddc::
-            ifft(Kokkos::DefaultHostExecutionSpace(),
-                 electrostatic_potential.span_view(),
-                 intermediate_chunk.span_view(),
-                 ddc::kwArgs_fft {norm});
+    fftw_execute(m_backward_plan);
+    ddc::deepcopy(electrostatic_potential, rho);
 
     // Compute efield = -dPhi/dx where Phi is the electrostatic potential
-    m_electric_field(electric_field, electrostatic_potential);
+    if (!m_spectral_electric_field) {
+        m_electric_field(electric_field, electrostatic_potential);
+    }
 }
@@ -1,12 +1,23 @@
+#include <algorithm>
 #include <iomanip>
 
-#include <fluid_moments.hpp>
-#include <maxwellianequilibrium.hpp>
 #include <pdi.h>
 
 #include "collisions_inter.hpp"
 #include "collisions_utils.hpp"
 
+CollisionsInter::BlockBuffers::BlockBuffers(IDomainSpVx const& dom_spvx)
+    : fdistribu_half(dom_spvx)
+    , nustar_profile(ddc::select<IDimSp>(dom_spvx))
+    , density(ddc::select<IDimSp>(dom_spvx))
+    , mean_velocity(ddc::select<IDimSp>(dom_spvx))
+    , temperature(ddc::select<IDimSp>(dom_spvx))
+    , collfreq_ab(ddc::select<IDimSp>(dom_spvx))
+    , momentum_exchange_ab(ddc::select<IDimSp>(dom_spvx))
+    , energy_exchange_ab(ddc::select<IDimSp>(dom_spvx))
+{
+}
+
 /**
  *  Treatment of the inter species collision operator
  *  We solve the following equation:
@@ -21,6 +32,7 @@
 CollisionsInter::CollisionsInter(IDomainSpXVx const& mesh, double nustar0)
     : m_nustar0(nustar0)
     , m_nustar_profile(ddc::select<IDimSp, IDimX>(mesh))
+    , m_moments(Quadrature<IDimVx>(trapezoid_quadrature_coefficients(ddc::select<IDimVx>(mesh))))
 {
     // validity checks
     if (ddc::select<IDimSp>(mesh).size() != 2) {
@@ -32,94 +44,111 @@ CollisionsInter::CollisionsInter(IDomainSpXVx const& mesh, double nustar0)
 
     compute_nustar_profile(m_nustar_profile.span_view(), m_nustar0);
     ddc::expose_to_pdi("collinter_nustar0", m_nustar0);
+
+    // the spatial grid is cut in one block per thread, each block owns its own buffers
+    std::size_t const n_blocks = std::clamp<std::size_t>(
+            Kokkos::DefaultHostExecutionSpace().concurrency(),
+            1,
+            ddc::select<IDimX>(mesh).size());
+    m_buffers.reserve(n_blocks);
+    for (std::size_t ib = 0; ib < n_blocks; ++ib) {
+        m_buffers.emplace_back(ddc::select<IDimSp, IDimVx>(mesh));
+    }
 }
 
 /**
- * right hand side of the equation \partial f / \partial_t = C_ab
+ * Computes the collision frequencies, momentum and energy exchange terms
+ * from the fluid moments stored in the buffers
  */
-void CollisionsInter::compute_rhs(
-        DSpanSpVx const rhs,
-        DViewSp const nustar_profile,
-        DViewSpVx const allfdistribu) const
+void CollisionsInter::compute_exchange_terms(BlockBuffers& buffers) const
 {
-    IDomainSp const dom_sp(ddc::get_domain<IDimSp>(allfdistribu));
-    IDomainVx const gridvx(ddc::get_domain<IDimVx>(allfdistribu));
-
-    FluidMoments moments(Quadrature<IDimVx>(trapezoid_quadrature_coefficients(gridvx)));
-
-    //Moments computation
-    DFieldSp density(dom_sp);
-    DFieldSp fluid_velocity(dom_sp);
-    DFieldSp temperature(dom_sp);
-    ddc::for_each(dom_sp, [&](IndexSp const isp) {
-        moments(density(isp), allfdistribu[isp], FluidMoments::s_density);
-        moments(fluid_velocity(isp), allfdistribu[isp], density(isp), FluidMoments::s_velocity);
-        moments(temperature(isp),
-                allfdistribu[isp],
-                density(isp),
-                fluid_velocity(isp),
-                FluidMoments::s_temperature);
-    });
-
-    //Collision frequencies, momentum and energy exchange terms
-    DFieldSp collfreq_ab(dom_sp);
-    compute_collfreq_ab(collfreq_ab.span_view(), nustar_profile, density, temperature);
-    DFieldSp momentum_exchange_ab(dom_sp);
-    DFieldSp energy_exchange_ab(dom_sp);
+    compute_collfreq_ab(
+            buffers.collfreq_ab.span_view(),
+            buffers.nustar_profile.span_cview(),
+            buffers.density.span_cview(),
+            buffers.temperature.span_cview());
     compute_momentum_energy_exchange(
-            momentum_exchange_ab.span_view(),
-            energy_exchange_ab.span_view(),
-            collfreq_ab,
-            density,
-            fluid_velocity,
-            temperature);
-
-    ddc::for_each(dom_sp, [&](IndexSp const isp) {
-        DFieldVx fmaxwellian(gridvx);
-        MaxwellianEquilibrium::compute_maxwellian(
-                fmaxwellian.span_view(),
-                density(isp),
-                temperature(isp),
-                fluid_velocity(isp));
-
-        ddc::for_each(gridvx, [&](IndexVx const ivx) {
-            double const coordv = ddc::coordinate(ivx);
-            double const term_v(coordv - fluid_velocity(isp));
-            rhs(isp, ivx) = (2. * energy_exchange_ab(isp)
-                                     * (0.5 / temperature(isp) * term_v * term_v - 0.5)
-                             + momentum_exchange_ab(isp) * term_v)
-                            * fmaxwellian(ivx) / (density(isp) * temperature(isp));
-        });
-    });
+            buffers.momentum_exchange_ab.span_view(),
+            buffers.energy_exchange_ab.span_view(),
+            buffers.collfreq_ab.span_cview(),
+            buffers.density.span_cview(),
+            buffers.mean_velocity.span_cview(),
+            buffers.temperature.span_cview());
 }
 
-
 DSpanSpXVx CollisionsInter::operator()(DSpanSpXVx allfdistribu, double dt) const
 {
+    IDomainSp const dom_sp(ddc::get_domain<IDimSp>(allfdistribu));
+    IDomainX const gridx(ddc::get_domain<IDimX>(allfdistribu));
     IDomainVx const gridvx(ddc::get_domain<IDimVx>(allfdistribu));
-    FluidMoments moments(Quadrature<IDimVx>(trapezoid_quadrature_coefficients(gridvx)));
-    ddc::for_each(ddc::get_domain<IDimX>(allfdistribu), [&](IndexX const ix) {
-        //RK2 first step
-        DFieldSpVx coll_term(ddc::get_domain<IDimSp, IDimVx>(allfdistribu));
-        DFieldSp nustar_profile_copy(ddc::get_domain<IDimSp>(allfdistribu));
-        ddc::deepcopy(nustar_profile_copy, m_nustar_profile[ix]);
-        DFieldSpVx allfdistribu_copy(ddc::get_domain<IDimSp, IDimVx>(allfdistribu));
-        ddc::deepcopy(allfdistribu_copy, allfdistribu[ix]);
-        DFieldSpVx allfdistribu_half(ddc::get_domain<IDimSp, IDimVx>(allfdistribu));
-        compute_rhs(coll_term.span_view(), nustar_profile_copy.span_cview(), allfdistribu_copy);
-        ddc::for_each(ddc::get_domain<IDimSp, IDimVx>(allfdistribu), [&](IndexSpVx const ispvx) {
-            IndexSp const isp(ddc::select<IDimSp>(ispvx));
-            IndexVx const ivx(ddc::select<IDimVx>(ispvx));
-            allfdistribu_half(isp, ivx) = allfdistribu(isp, ix, ivx) + coll_term(ispvx) * dt / 2;
-        });
+    std::size_t const n_blocks = std::min(m_buffers.size(), gridx.size());
+    ddc::DiscreteDomain<DDimBlock> const
+            block_dom(ddc::DiscreteElement<DDimBlock>(0), ddc::DiscreteVector<DDimBlock>(n_blocks));
+
+    ddc::for_each(
+            ddc::parallel_host_policy(),
+            block_dom,
+            [&](ddc::DiscreteElement<DDimBlock> const iblock) {
+                std::size_t const ib = (iblock - block_dom.front()).value();
+                std::size_t const x_begin = ib * gridx.size() / n_blocks;
+                std::size_t const x_end = (ib + 1) * gridx.size() / n_blocks;
+                IDomainX const gridx_block(gridx.front() + IVectX(x_begin), IVectX(x_end - x_begin));
+                BlockBuffers& buffers = m_buffers[ib];
+                DSpanSpVx const fdistribu_half = buffers.fdistribu_half.span_view();
+
+                // right hand side of the equation \partial f / \partial_t = C_ab
+                // for the species isp at the velocity coordv
+                auto const collision_term = [&](IndexSp const isp, double const coordv) {
+                    double const density = buffers.density(isp);
+                    double const temperature = buffers.temperature(isp);
+                    double const term_v(coordv - buffers.mean_velocity(isp));
+                    double const fmaxwellian_on_density
+                            = std::exp(-term_v * term_v / (2. * temperature))
+                              / std::sqrt(2. * M_PI * temperature);
+                    return (2. * buffers.energy_exchange_ab(isp)
+                                    * (0.5 / temperature * term_v * term_v - 0.5)
+                            + buffers.momentum_exchange_ab(isp) * term_v)
+                           * fmaxwellian_on_density / temperature;
+                };
+
+                for (IndexX const ix : gridx_block) {
+                    //RK2 first step
+                    for (IndexSp const isp : dom_sp) {
+                        buffers.nustar_profile(isp) = m_nustar_profile(isp, ix);
+                        m_moments(
+                                buffers.density(isp),
+                                buffers.mean_velocity(isp),
+                                buffers.temperature(isp),
+                                allfdistribu[IndexSpX(isp, ix)],
+                                FluidMoments::s_all);
+                    }
+                    compute_exchange_terms(buffers);
+                    for (IndexSp const isp : dom_sp) {
+                        DViewVx const fdistribu = allfdistribu[IndexSpX(isp, ix)];
+                        for (IndexVx const ivx : gridvx) {
+                            fdistribu_half(isp, ivx)
+                                    = fdistribu(ivx)
+                                      + collision_term(isp, ddc::coordinate(ivx)) * dt / 2;
+                        }
+                    }
 
-        //RK2 final step
-        compute_rhs(coll_term.span_view(), nustar_profile_copy.span_cview(), allfdistribu_half);
-        ddc::for_each(ddc::get_domain<IDimSp, IDimVx>(allfdistribu), [&](IndexSpVx const ispvx) {
-            IndexSp const isp(ddc::select<IDimSp>(ispvx));
-            IndexVx const ivx(ddc::select<IDimVx>(ispvx));
-            allfdistribu(isp, ix, ivx) = allfdistribu(isp, ix, ivx) + coll_term(ispvx) * dt;
-        });
-    });
+                    //RK2 final step
+                    for (IndexSp const isp : dom_sp) {
+                        m_moments(
+                                buffers.density(isp),
+                                buffers.mean_velocity(isp),
+                                buffers.temperature(isp),
+                                fdistribu_half[isp],
+                                FluidMoments::s_all);
+                    }
+                    compute_exchange_terms(buffers);
+                    for (IndexSp const isp : dom_sp) {
+                        DSpanVx const fdistribu = allfdistribu[IndexSpX(isp, ix)];
+                        for (IndexVx const ivx : gridvx) {
+                            fdistribu(ivx) += collision_term(isp, ddc::coordinate(ivx)) * dt;
+                        }
+                    }
+                }
+            });
     return allfdistribu;
 }
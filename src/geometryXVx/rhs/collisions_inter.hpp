@@ -2,9 +2,11 @@
 
 #include <cassert>
 #include <cmath>
+#include <vector>
 
 #include <ddc/ddc.hpp>
 
+#include <fluid_moments.hpp>
 #include <geometry.hpp>
 #include <irighthandside.hpp>
 #include <quadrature.hpp>
@@ -14,8 +16,32 @@
 class CollisionsInter : public IRightHandSide
 {
 private:
+    // A dimension used to index the blocks of work
+    struct DDimBlock
+    {
+    };
+
+    // The buffers used by one block of the spatial grid
+    struct BlockBuffers
+    {
+        DFieldSpVx fdistribu_half;
+        DFieldSp nustar_profile;
+        DFieldSp density;
+        DFieldSp mean_velocity;
+        DFieldSp temperature;
+        DFieldSp collfreq_ab;
+        DFieldSp momentum_exchange_ab;
+        DFieldSp energy_exchange_ab;
+
+        explicit BlockBuffers(IDomainSpVx const& dom_spvx);
+    };
+
     double m_nustar0;
     DFieldSpX m_nustar_profile;
+    FluidMoments m_moments;
+
+    // pre-allocated memory, one set of buffers per block of the spatial grid
+    mutable std::vector<BlockBuffers> m_buffers;
 
 public:
     CollisionsInter(IDomainSpXVx const& mesh, double nustar0);
@@ -27,5 +53,5 @@ public:
     double get_nustar0() const;
 
 private:
-    void compute_rhs(DSpanSpVx rhs, DViewSp nustar_profile, DViewSpVx allfdistribu) const;
+    void compute_exchange_terms(BlockBuffers& buffers) const;
 };
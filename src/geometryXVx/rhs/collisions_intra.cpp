@@ -1,6 +1,7 @@
+#include <algorithm>
+#include <cmath>
 #include <iomanip>
 
-#include <fluid_moments.hpp>
 #include <pdi.h>
 
 #include "collisions_intra.hpp"
@@ -50,12 +51,8 @@ CollisionsIntra::CollisionsIntra(IDomainSpXVx const& mesh, double nustar0)
               ddc::DiscreteElement<ghosted_vx_staggered_point_sampling>(0),
               ddc::DiscreteVector<ghosted_vx_staggered_point_sampling>(
                       ddc::select<IDimVx>(mesh).size() + 1))
-    , m_mesh_ghosted(ddc::select<IDimSp>(mesh), ddc::select<IDimX>(mesh), m_gridvx_ghosted)
-    , m_mesh_ghosted_staggered(
-              ddc::select<IDimSp>(mesh),
-              ddc::select<IDimX>(mesh),
-              m_gridvx_ghosted_staggered)
-
+    , m_quadrature_coeffs(trapezoid_quadrature_coefficients(ddc::select<IDimVx>(mesh)))
+    , m_moments(Quadrature<IDimVx>(trapezoid_quadrature_coefficients(ddc::select<IDimVx>(mesh))))
 {
     // validity checks
     if (ddc::select<IDimSp>(mesh).size() != 2) {
@@ -126,147 +123,196 @@ ddc::DiscreteDomain<CollisionsIntra::ghosted_vx_staggered_point_sampling> const&
     return m_gridvx_ghosted_staggered;
 }
 
-ddc::DiscreteDomain<IDimSp, IDimX, CollisionsIntra::ghosted_vx_point_sampling> const&
-CollisionsIntra::get_mesh_ghosted() const
-{
-    return m_mesh_ghosted;
-}
-
 /**
- * Computes the matrix coefficients for the non equidistant Crank Nicolson scheme
+ * Advances one (species, x) line of the distribution function with the non equidistant
+ * Crank Nicolson scheme. The coefficients of the operator, the matrix coefficients and the
+ * rhs vector are computed on the fly, so only the buffers Dcoll, Dcoll_staggered, aa, bb, cc
+ * and rr of the size of the velocity grid are needed.
+ * The tridiagonal system is solved with the Thomas algorithm, which is stable without pivoting
+ * when the matrix is diagonally dominant. This is the case unless the convection dominates the
+ * diffusion on a cell, for stiff parameters, where the LU factorisation with partial pivoting
+ * of LAPACK is used instead.
  */
-void CollisionsIntra::compute_matrix_coeff(
-        DSpanSpXVx AA,
-        DSpanSpXVx BB,
-        DSpanSpXVx CC,
-        ddc::ChunkSpan<double, IDomainSpXVx_ghosted> Dcoll,
-        ddc::ChunkSpan<double, IDomainSpXVx_ghosted_staggered> Dcoll_staggered,
-        ddc::ChunkSpan<double, IDomainSpXVx_ghosted> Nucoll,
-        double deltat) const
+void CollisionsIntra::solve_column(
+        DSpanVx fdistribu,
+        double const collfreq,
+        double const temperature,
+        double const dt,
+        ddc::ChunkSpan<double, ddc::DiscreteDomain<ghosted_vx_point_sampling>> Dcoll,
+        ddc::ChunkSpan<double, ddc::DiscreteDomain<ghosted_vx_staggered_point_sampling>>
+                Dcoll_staggered,
+        DSpanVx aa,
+        DSpanVx bb,
+        DSpanVx cc,
+        DSpanVx rr) const
 {
-    ddc::for_each(AA.domain(), [&](IndexSpXVx const ispxvx) {
-        IndexSp const isp = ddc::select<IDimSp>(ispxvx);
-        IndexX const ix = ddc::select<IDimX>(ispxvx);
+    IDomainVx const gridvx = fdistribu.domain();
+
+    // diffusion coefficient and the integrals defining the kernel maxwellian moments
+    double I0mean = 0.;
+    double I1mean = 0.;
+    double I2mean = 0.;
+    double I3mean = 0.;
+    double I4mean = 0.;
+    for (IndexVx const ivx : gridvx) {
+        IndexVx_ghosted const ivx_ghosted(ivx.uid() + 1);
+        double const coordv = ddc::coordinate(ivx);
+        auto const [Dcoll_loc, dvDcoll_loc]
+                = compute_Dcoll_dvDcoll_at(coordv, collfreq, temperature);
+        Dcoll(ivx_ghosted) = Dcoll_loc;
+
+        double const I0mean_integrand = Dcoll_loc * fdistribu(ivx);
+        double const I1mean_integrand = I0mean_integrand * coordv;
+        double const I3mean_integrand = dvDcoll_loc * fdistribu(ivx);
+        I0mean += m_quadrature_coeffs(ivx) * I0mean_integrand;
+        I1mean += m_quadrature_coeffs(ivx) * I1mean_integrand;
+        I2mean += m_quadrature_coeffs(ivx) * I1mean_integrand * coordv;
+        I3mean += m_quadrature_coeffs(ivx) * I3mean_integrand;
+        I4mean += m_quadrature_coeffs(ivx) * (I0mean_integrand + I3mean_integrand * coordv);
+    }
+    for (IndexVx_ghosted const ivx_ghosted : {m_gridvx_ghosted.front(), m_gridvx_ghosted.back()}) {
+        Dcoll(ivx_ghosted) = compute_Dcoll_dvDcoll_at(
+                                     ddc::coordinate(ivx_ghosted),
+                                     collfreq,
+                                     temperature)
+                                     .first;
+    }
+    for (IndexVx_ghosted_staggered const ivx_ghosted_staggered : m_gridvx_ghosted_staggered) {
+        Dcoll_staggered(ivx_ghosted_staggered) = compute_Dcoll_dvDcoll_at(
+                                                         ddc::coordinate(ivx_ghosted_staggered),
+                                                         collfreq,
+                                                         temperature)
+                                                         .first;
+    }
+
+    // kernel maxwellian fluid moments
+    double const inv_Pcoll(1. / (I0mean * I4mean - I1mean * I3mean));
+    double const Vcoll = inv_Pcoll * (I1mean * I4mean - I2mean * I3mean);
+    double const Tcoll = inv_Pcoll * (I0mean * I2mean - I1mean * I1mean);
 
-        IndexVx_ghosted ivx_ghosted(ddc::select<IDimVx>(ispxvx).uid() + 1);
-        IndexVx_ghosted_staggered ivx_ghosted_staggered(ddc::select<IDimVx>(ispxvx).uid() + 1);
-        IndexVx_ghosted ivx_next_ghosted(ivx_ghosted + 1);
-        IndexVx_ghosted ivx_prev_ghosted(ivx_ghosted - 1);
-        IndexVx_ghosted_staggered ivx_prev_ghosted_staggered(ivx_ghosted_staggered - 1);
+    // convection coefficient Nucoll
+    auto const Nucoll = [&](IndexVx_ghosted const ivx_ghosted) {
+        return -Dcoll(ivx_ghosted) * (ddc::coordinate(ivx_ghosted) - Vcoll) / Tcoll;
+    };
+
+    // matrix and rhs vector coefficients
+    bool diagonally_dominant = true;
+    for (IndexVx const ivx : gridvx) {
+        IndexVx_ghosted const ivx_ghosted(ivx.uid() + 1);
+        IndexVx_ghosted_staggered const ivx_ghosted_staggered(ivx.uid() + 1);
+        IndexVx_ghosted const ivx_next_ghosted(ivx_ghosted + 1);
+        IndexVx_ghosted const ivx_prev_ghosted(ivx_ghosted - 1);
+        IndexVx_ghosted_staggered const ivx_prev_ghosted_staggered(ivx_ghosted_staggered - 1);
 
         double const dv_i = ddc::coordinate(ivx_next_ghosted) - ddc::coordinate(ivx_ghosted);
         double const delta_i
                 = dv_i / (ddc::coordinate(ivx_ghosted) - ddc::coordinate(ivx_prev_ghosted));
 
-        double const alpha_i = deltat / (dv_i * dv_i * (1. + delta_i));
-        double const beta_i = deltat / (2. * dv_i * (1. + delta_i));
+        double const alpha_i = dt / (dv_i * dv_i * (1. + delta_i));
+        double const beta_i = dt / (2. * dv_i * (1. + delta_i));
 
         double const coeffa
                 = alpha_i
-                          * (Dcoll_staggered(isp, ix, ivx_prev_ghosted_staggered) * delta_i
-                                     * delta_i * delta_i
-                             - Dcoll(isp, ix, ivx_ghosted) * delta_i * delta_i * (delta_i - 1.))
-                  + beta_i * Nucoll(isp, ix, ivx_prev_ghosted) * delta_i * delta_i;
+                          * (Dcoll_staggered(ivx_prev_ghosted_staggered) * delta_i * delta_i
+                                     * delta_i
+                             - Dcoll(ivx_ghosted) * delta_i * delta_i * (delta_i - 1.))
+                  + beta_i * Nucoll(ivx_prev_ghosted) * delta_i * delta_i;
 
         double const coeffb = -alpha_i
-                                      * (-Dcoll_staggered(isp, ix, ivx_ghosted_staggered)
-                                         - Dcoll_staggered(isp, ix, ivx_prev_ghosted_staggered)
-                                                   * delta_i * delta_i * delta_i
-                                         + Dcoll(isp, ix, ivx_ghosted) * (delta_i - 1.)
+                                      * (-Dcoll_staggered(ivx_ghosted_staggered)
+                                         - Dcoll_staggered(ivx_prev_ghosted_staggered) * delta_i
+                                                   * delta_i * delta_i
+                                         + Dcoll(ivx_ghosted) * (delta_i - 1.)
                                                    * (delta_i * delta_i - 1.))
-                              + beta_i * Nucoll(isp, ix, ivx_ghosted) * (delta_i * delta_i - 1.);
+                              + beta_i * Nucoll(ivx_ghosted) * (delta_i * delta_i - 1.);
 
         double const coeffc = alpha_i
-                                      * (Dcoll_staggered(isp, ix, ivx_ghosted_staggered)
-                                         + Dcoll(isp, ix, ivx_ghosted) * (delta_i - 1.))
-                              - beta_i * Nucoll(isp, ix, ivx_next_ghosted);
-
-        AA(ispxvx) = -coeffa;
-        BB(ispxvx) = 1. + coeffb;
-        CC(ispxvx) = -coeffc;
-    });
-}
+                                      * (Dcoll_staggered(ivx_ghosted_staggered)
+                                         + Dcoll(ivx_ghosted) * (delta_i - 1.))
+                              - beta_i * Nucoll(ivx_next_ghosted);
+
+        aa(ivx) = -coeffa;
+        bb(ivx) = 1. + coeffb;
+        cc(ivx) = -coeffc;
+
+        rr(ivx) = (2. - bb(ivx)) * fdistribu(ivx);
+        double off_diagonal = 0.;
+        if (ivx == gridvx.front()) {
+            rr(ivx) += -cc(ivx) * fdistribu(ivx + 1) - 2. * aa(ivx) * m_fthresh;
+            off_diagonal = std::fabs(cc(ivx));
+        } else if (ivx == gridvx.back()) {
+            rr(ivx) += -aa(ivx) * fdistribu(ivx - 1) - 2. * cc(ivx) * m_fthresh;
+            off_diagonal = std::fabs(aa(ivx));
+        } else {
+            rr(ivx) += -aa(ivx) * fdistribu(ivx - 1) - cc(ivx) * fdistribu(ivx + 1);
+            off_diagonal = std::fabs(aa(ivx)) + std::fabs(cc(ivx));
+        }
+        diagonally_dominant = diagonally_dominant && (std::fabs(bb(ivx)) >= off_diagonal);
+    }
 
-void CollisionsIntra::fill_matrix_with_coeff(
-        Matrix_Banded& matrix,
-        DViewVx AA,
-        DViewVx BB,
-        DViewVx CC) const
-{
-    matrix.set_element(0, 0, BB(IndexVx(0)));
-    matrix.set_element(0, 1, CC(IndexVx(0)));
-
-    int const npoints(ddc::get_domain<IDimVx>(AA).size());
-    matrix.set_element(npoints - 1, npoints - 1, BB(IndexVx(npoints - 1)));
-    matrix.set_element(npoints - 1, npoints - 2, AA(IndexVx(npoints - 1)));
-
-    IDomainVx const gridvx_inner(
-            ddc::get_domain<IDimVx>(AA).remove_first(IVectVx(1)).remove_last(IVectVx(1)));
-    ddc::for_each(gridvx_inner, [&](IndexVx const ivx) {
-        matrix.set_element(ivx.uid(), ivx.uid() - 1, AA(ivx));
-        matrix.set_element(ivx.uid(), ivx.uid(), BB(ivx));
-        matrix.set_element(ivx.uid(), ivx.uid() + 1, CC(ivx));
-    });
+    if (!diagonally_dominant) {
+        solve_column_pivoted(fdistribu, aa, bb, cc, rr);
+        return;
+    }
+
+    // forward elimination of the Thomas algorithm
+    cc(gridvx.front()) /= bb(gridvx.front());
+    rr(gridvx.front()) /= bb(gridvx.front());
+    for (IndexVx const ivx : gridvx.remove_first(IVectVx(1))) {
+        double const inv_m = 1. / (bb(ivx) - aa(ivx) * cc(ivx - 1));
+        cc(ivx) *= inv_m;
+        rr(ivx) = (rr(ivx) - aa(ivx) * rr(ivx - 1)) * inv_m;
+    }
+
+    // back substitution
+    fdistribu(gridvx.back()) = rr(gridvx.back());
+    for (std::size_t i = gridvx.size() - 1; i > 0; --i) {
+        IndexVx const ivx = gridvx[i - 1];
+        fdistribu(ivx) = rr(ivx) - cc(ivx) * fdistribu(ivx + 1);
+    }
 }
 
 /**
- * Computes the rhs vector coefficients for the non equidistant Crank Nicolson scheme
+ * Solves the tridiagonal system of one (species, x) line with an LU factorisation with
+ * partial pivoting, for the matrices which are not diagonally dominant.
  */
-void CollisionsIntra::compute_rhs_vector(
-        DSpanSpXVx RR,
-        DViewSpXVx AA,
-        DViewSpXVx BB,
-        DViewSpXVx CC,
-        DViewSpXVx allfdistribu,
-        double fthresh) const
+void CollisionsIntra::solve_column_pivoted(
+        DSpanVx fdistribu,
+        DViewVx aa,
+        DViewVx bb,
+        DViewVx cc,
+        DSpanVx rr) const
 {
-    ddc::for_each(RR.domain(), [&](IndexSpXVx const ispxvx) {
-        IndexSp const isp = ddc::select<IDimSp>(ispxvx);
-        IndexX const ix = ddc::select<IDimX>(ispxvx);
-        IndexVx const ivx = ddc::select<IDimVx>(ispxvx);
-
-        IndexVx const ivx_next = ivx + 1;
-        IndexVx const ivx_prev = ivx - 1;
-
-        if (ivx == ddc::get_domain<IDimVx>(AA).front()) {
-            RR(isp, ix, ivx) = (2. - BB(isp, ix, ivx)) * allfdistribu(isp, ix, ivx)
-                               + (-CC(isp, ix, ivx)) * allfdistribu(isp, ix, ivx_next)
-                               - 2. * AA(isp, ix, ivx) * fthresh;
-
-        } else if (ivx == ddc::get_domain<IDimVx>(AA).back()) {
-            RR(isp, ix, ivx) = (2. - BB(isp, ix, ivx)) * allfdistribu(isp, ix, ivx)
-                               + (-AA(isp, ix, ivx)) * allfdistribu(isp, ix, ivx_prev)
-                               - 2. * CC(isp, ix, ivx) * fthresh;
-
-        } else {
-            RR(isp, ix, ivx) = -AA(isp, ix, ivx) * allfdistribu(isp, ix, ivx_prev)
-                               + (2. - BB(isp, ix, ivx)) * allfdistribu(isp, ix, ivx)
-                               - CC(isp, ix, ivx) * allfdistribu(isp, ix, ivx_next);
+    IDomainVx const gridvx = fdistribu.domain();
+    int const npoints = gridvx.size();
+    Matrix_Banded matrix(npoints, 1, 1);
+    for (IndexVx const ivx : gridvx) {
+        int const i = (ivx - gridvx.front()).value();
+        if (ivx != gridvx.front()) {
+            matrix.set_element(i, i - 1, aa(ivx));
+        }
+        matrix.set_element(i, i, bb(ivx));
+        if (ivx != gridvx.back()) {
+            matrix.set_element(i, i + 1, cc(ivx));
         }
-    });
+    }
+    matrix.factorize();
+    matrix.solve_inplace(DSpan1D(rr.data_handle(), npoints));
+    ddc::deepcopy(fdistribu, rr);
 }
 
-
-
 DSpanSpXVx CollisionsIntra::operator()(DSpanSpXVx allfdistribu, double dt) const
 {
     // density and temperature
     DFieldSpX density(ddc::get_domain<IDimSp, IDimX>(allfdistribu));
     DFieldSpX mean_velocity(ddc::get_domain<IDimSp, IDimX>(allfdistribu));
     DFieldSpX temperature(ddc::get_domain<IDimSp, IDimX>(allfdistribu));
-    FluidMoments moments(Quadrature<IDimVx>(
-            trapezoid_quadrature_coefficients(ddc::get_domain<IDimVx>(allfdistribu))));
-
-    moments(density.span_view(), allfdistribu.span_cview(), FluidMoments::s_density);
-    moments(mean_velocity.span_view(),
+    m_moments(
+            density.span_view(),
+            mean_velocity.span_view(),
+            temperature.span_view(),
             allfdistribu.span_cview(),
-            density.span_cview(),
-            FluidMoments::s_velocity);
-    moments(temperature.span_view(),
-            allfdistribu.span_cview(),
-            density.span_cview(),
-            mean_velocity.span_cview(),
-            FluidMoments::s_temperature);
+            FluidMoments::s_all);
 
     // collision frequency
     DFieldSpX collfreq(ddc::get_domain<IDimSp, IDimX>(allfdistribu));
@@ -276,85 +322,50 @@ DSpanSpXVx CollisionsIntra::operator()(DSpanSpXVx allfdistribu, double dt) const
             density.span_cview(),
             temperature.span_cview());
 
-    // diffusion coefficient
-    ddc::Chunk<double, IDomainSpXVx_ghosted> Dcoll(m_mesh_ghosted);
-    compute_Dcoll<ghosted_vx_point_sampling>(
-            Dcoll.span_view(),
-            collfreq.span_cview(),
-            density.span_cview(),
-            temperature.span_cview());
-
-    ddc::Chunk<double, IDomainSpXVx_ghosted> dvDcoll(m_mesh_ghosted);
-    compute_dvDcoll<ghosted_vx_point_sampling>(
-            dvDcoll.span_view(),
-            collfreq.span_cview(),
-            density.span_cview(),
-            temperature.span_cview());
-
-    ddc::Chunk<double, IDomainSpXVx_ghosted_staggered> Dcoll_staggered(m_mesh_ghosted_staggered);
-    compute_Dcoll<ghosted_vx_staggered_point_sampling>(
-            Dcoll_staggered.span_view(),
-            collfreq.span_cview(),
-            density.span_cview(),
-            temperature.span_cview());
-
-    // kernel maxwellian fluid moments
-    DFieldSpX Vcoll(ddc::get_domain<IDimSp, IDimX>(allfdistribu));
-    DFieldSpX Tcoll(ddc::get_domain<IDimSp, IDimX>(allfdistribu));
-    compute_Vcoll_Tcoll(
-            Vcoll.span_view(),
-            Tcoll.span_view(),
-            allfdistribu.span_cview(),
-            Dcoll.span_cview(),
-            dvDcoll.span_cview());
-
-    // convection coefficient Nucoll
-    ddc::Chunk<double, IDomainSpXVx_ghosted> Nucoll(m_mesh_ghosted);
-    compute_Nucoll<ghosted_vx_point_sampling>(
-            Nucoll.span_view(),
-            Dcoll.span_view(),
-            Vcoll.span_cview(),
-            Tcoll.span_cview());
-
-    // matrix coefficients
-    DFieldSpXVx AA(allfdistribu.domain());
-    DFieldSpXVx BB(allfdistribu.domain());
-    DFieldSpXVx CC(allfdistribu.domain());
-    compute_matrix_coeff(
-            AA.span_view(),
-            BB.span_view(),
-            CC.span_view(),
-            Dcoll.span_view(),
-            Dcoll_staggered.span_view(),
-            Nucoll.span_view(),
-            dt);
-
-    // rhs vector coefficient
-    DFieldSpXVx RR(allfdistribu.domain());
-    compute_rhs_vector(
-            RR.span_view(),
-            AA.span_cview(),
-            BB.span_cview(),
-            CC.span_cview(),
-            allfdistribu.span_cview(),
-            m_fthresh);
-
-
-    ddc::for_each(ddc::get_domain<IDimSp, IDimX>(allfdistribu), [&](IndexSpX const ispx) {
-        Matrix_Banded matrix(ddc::get_domain<IDimVx>(allfdistribu).size(), 1, 1);
-        fill_matrix_with_coeff(
-                matrix,
-                AA[ispx].span_cview(),
-                BB[ispx].span_cview(),
-                CC[ispx].span_cview());
-
-        DSpan1D RR_Span1D(
-                RR[ispx].allocation_mdspan().data_handle(),
-                ddc::get_domain<IDimVx>(allfdistribu).size());
-        matrix.factorize();
-        matrix.solve_inplace(RR_Span1D);
-        ddc::deepcopy(allfdistribu[ispx], RR[ispx]);
-    });
+    // the spatial grid is cut in one block per thread, each block owns its own buffers
+    IDomainX const gridx = ddc::get_domain<IDimX>(allfdistribu);
+    IDomainSp const dom_sp = ddc::get_domain<IDimSp>(allfdistribu);
+    IDomainVx const gridvx = ddc::get_domain<IDimVx>(allfdistribu);
+    std::size_t const n_blocks = std::clamp<std::size_t>(
+            Kokkos::DefaultHostExecutionSpace().concurrency(),
+            1,
+            gridx.size());
+    ddc::DiscreteDomain<DDimBlock> const
+            block_dom(ddc::DiscreteElement<DDimBlock>(0), ddc::DiscreteVector<DDimBlock>(n_blocks));
+
+    ddc::for_each(
+            ddc::parallel_host_policy(),
+            block_dom,
+            [&](ddc::DiscreteElement<DDimBlock> const iblock) {
+                std::size_t const ib = (iblock - block_dom.front()).value();
+                std::size_t const x_begin = ib * gridx.size() / n_blocks;
+                std::size_t const x_end = (ib + 1) * gridx.size() / n_blocks;
+                IDomainX const gridx_block(gridx.front() + IVectX(x_begin), IVectX(x_end - x_begin));
+
+                // pre-allocate some memory to prevent allocation later in loop
+                ddc::Chunk<double, ddc::DiscreteDomain<ghosted_vx_point_sampling>> Dcoll(
+                        m_gridvx_ghosted);
+                ddc::Chunk<double, ddc::DiscreteDomain<ghosted_vx_staggered_point_sampling>>
+                        Dcoll_staggered(m_gridvx_ghosted_staggered);
+                DFieldVx aa(gridvx);
+                DFieldVx bb(gridvx);
+                DFieldVx cc(gridvx);
+                DFieldVx rr(gridvx);
+
+                ddc::for_each(IDomainSpX(dom_sp, gridx_block), [&](IndexSpX const ispx) {
+                    solve_column(
+                            allfdistribu[ispx],
+                            collfreq(ispx),
+                            temperature(ispx),
+                            dt,
+                            Dcoll.span_view(),
+                            Dcoll_staggered.span_view(),
+                            aa.span_view(),
+                            bb.span_view(),
+                            cc.span_view(),
+                            rr.span_view());
+                });
+            });
 
     return allfdistribu;
 }
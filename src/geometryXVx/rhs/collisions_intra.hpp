@@ -7,6 +7,7 @@
 
 #include <sll/matrix_banded.hpp>
 
+#include <fluid_moments.hpp>
 #include <geometry.hpp>
 #include <irighthandside.hpp>
 #include <quadrature.hpp>
@@ -53,6 +54,11 @@ private:
         return ddc::DiscreteElement<GhostedVx>(index.uid() + 1);
     }
 
+    // A dimension used to index the blocks of work
+    struct DDimBlock
+    {
+    };
+
     static constexpr bool uniform_edge_v
             = std::is_same_v<IDimVx, ddc::UniformPointSampling<RDimVx>>;
 
@@ -89,8 +95,9 @@ private:
     ddc::DiscreteDomain<ghosted_vx_point_sampling> m_gridvx_ghosted;
     ddc::DiscreteDomain<ghosted_vx_staggered_point_sampling> m_gridvx_ghosted_staggered;
 
-    IDomainSpXVx_ghosted m_mesh_ghosted;
-    IDomainSpXVx_ghosted_staggered m_mesh_ghosted_staggered;
+    DFieldVx m_quadrature_coeffs;
+
+    FluidMoments m_moments;
 
 public:
     CollisionsIntra(IDomainSpXVx const& mesh, double nustar0);
@@ -106,24 +113,20 @@ public:
     ddc::DiscreteDomain<ghosted_vx_staggered_point_sampling> const& get_gridvx_ghosted_staggered()
             const;
 
-    ddc::DiscreteDomain<IDimSp, IDimX, ghosted_vx_point_sampling> const& get_mesh_ghosted() const;
-
-    void compute_rhs_vector(
-            DSpanSpXVx RR,
-            DViewSpXVx AA,
-            DViewSpXVx BB,
-            DViewSpXVx CC,
-            DViewSpXVx allfdistribu,
-            double fthresh) const;
-
-    void compute_matrix_coeff(
-            DSpanSpXVx AA,
-            DSpanSpXVx BB,
-            DSpanSpXVx CC,
-            ddc::ChunkSpan<double, IDomainSpXVx_ghosted> Dcoll,
-            ddc::ChunkSpan<double, IDomainSpXVx_ghosted_staggered> Dcoll_staggered,
-            ddc::ChunkSpan<double, IDomainSpXVx_ghosted> Nucoll,
-            double deltat) const;
-
-    void fill_matrix_with_coeff(Matrix_Banded& matrix, DViewVx AA, DViewVx BB, DViewVx CC) const;
+private:
+    void solve_column(
+            DSpanVx fdistribu,
+            double collfreq,
+            double temperature,
+            double dt,
+            ddc::ChunkSpan<double, ddc::DiscreteDomain<ghosted_vx_point_sampling>> Dcoll,
+            ddc::ChunkSpan<double, ddc::DiscreteDomain<ghosted_vx_staggered_point_sampling>>
+                    Dcoll_staggered,
+            DSpanVx aa,
+            DSpanVx bb,
+            DSpanVx cc,
+            DSpanVx rr) const;
+
+    void solve_column_pivoted(DSpanVx fdistribu, DViewVx aa, DViewVx bb, DViewVx cc, DSpanVx rr)
+            const;
 };
@@ -1,4 +1,6 @@
 #include <cassert>
+#include <cmath>
+#include <optional>
 #include <stdexcept>
 #include <string>
 
@@ -26,6 +28,15 @@
  * amplitude(electrons, x, t) = m_amplitude
  *                  * (density_ions(x,t) - m_density) / (density_electrons(x,t) - m_density)
  * so that the operator conserves locally the charge. 
+ *
+ * The ions are advanced with the exact solution:
+ * f(t+dt) = ftarget + (f(t)-ftarget)*exp(-amplitude*mask*dt)
+ * and the electrons relax to ftarget with the factor which conserves exactly the charge,
+ * considering the discrete density of ftarget n_target:
+ * f(t+dt) = ftarget + (f(t)-ftarget)
+ *                  * (1 - (density_ions(x,t) - n_target) / (density_electrons(x,t) - n_target)
+ *                           * (1 - exp(-amplitude*mask*dt)))
+ * When n_target equals m_density this is the exact solution of the equation.
  */
 KrookSourceAdaptive::KrookSourceAdaptive(
         IDomainX const& gridx,
@@ -43,6 +54,9 @@ KrookSourceAdaptive::KrookSourceAdaptive(
     , m_density(density)
     , m_temperature(temperature)
     , m_ftarget(gridvx)
+    , m_integrate_v(trapezoid_quadrature_coefficients(gridvx))
+    , m_decay_dt(std::nan(""))
+    , m_decay(gridx)
 {
     // mask that defines the region where the operator is active
     switch (m_type) {
@@ -58,6 +72,7 @@ KrookSourceAdaptive::KrookSourceAdaptive(
 
     // target distribution function
     MaxwellianEquilibrium::compute_maxwellian(m_ftarget, m_density, m_temperature, 0.);
+    m_density_target = m_integrate_v(m_ftarget.span_cview());
 
     switch (m_type) {
     case RhsType::Source:
@@ -82,14 +97,10 @@ KrookSourceAdaptive::KrookSourceAdaptive(
 }
 
 /**
- * Computes the amplitude parameter for each species: 
- * amplitudes(ions) = m_amplitude = constant
- * amplitudes(electrons, x, t) = m_amplitude
- *                  * (density_ions(x,t) - m_density) / (density_electrons(x,t) - m_density)
+ * Finds the index of the ion species, the operator requires one ion and one electron species
  */
-void KrookSourceAdaptive::get_amplitudes(DSpanSp amplitudes, DViewSpVx const allfdistribu) const
+IndexSp KrookSourceAdaptive::find_ion(IDomainSp const dom_sp) const
 {
-    IDomainSp const dom_sp(ddc::get_domain<IDimSp>(allfdistribu));
     assert(dom_sp.size() == 2);
     assert(charge(dom_sp.front()) * charge(dom_sp.back()) < 0);
     std::optional<IndexSp> iion_opt;
@@ -98,46 +109,42 @@ void KrookSourceAdaptive::get_amplitudes(DSpanSp amplitudes, DViewSpVx const all
             iion_opt = isp;
         }
     }
-    IndexSp iion(iion_opt.value());
-    amplitudes(iion) = m_amplitude;
-
-    IDomainVx const gridvx = allfdistribu.domain<IDimVx>();
-    Quadrature<IDimVx> const integrate_v(trapezoid_quadrature_coefficients(gridvx));
-    double const density_ion = integrate_v(allfdistribu[iion]);
-    double const density_electron = integrate_v(allfdistribu[ielec()]);
-
-    amplitudes(ielec()) = m_amplitude * (density_ion - m_density) / (density_electron - m_density);
+    return iion_opt.value();
 }
 
-
 DSpanSpXVx KrookSourceAdaptive::operator()(DSpanSpXVx const allfdistribu, double const dt) const
 {
-    ddc::for_each(ddc::get_domain<IDimX>(allfdistribu), [&](IndexX const ix) {
-        // RK2 first half step
-        DFieldSpVx allfdistribu_half(allfdistribu[ix]);
-        DFieldSp amplitudes(ddc::get_domain<IDimSp>(allfdistribu));
-        get_amplitudes(amplitudes.span_view(), allfdistribu_half.span_cview());
-        ddc::for_each(ddc::get_domain<IDimSp, IDimVx>(allfdistribu), [&](IndexSpVx const ispvx) {
-            IndexSp isp(ddc::select<IDimSp>(ispvx));
-            IndexVx ivx(ddc::select<IDimVx>(ispvx));
-            IndexSpXVx ispxvx(isp, ix, ivx);
-            double const df = -m_mask(ix) * amplitudes(isp)
-                              * (allfdistribu(ispxvx) - m_ftarget(ivx)) * dt / 2.0;
-            allfdistribu_half(isp, ivx) = allfdistribu(ispxvx) + df;
+    // the decay factors of the ions only depend on the time step
+    if (dt != m_decay_dt) {
+        ddc::for_each(m_decay.domain(), [&](IndexX const ix) {
+            m_decay(ix) = std::exp(-m_amplitude * m_mask(ix) * dt);
         });
+        m_decay_dt = dt;
+    }
 
-        // RK2 final step
-        get_amplitudes(amplitudes.span_view(), allfdistribu_half.span_cview());
-        ddc::for_each(ddc::get_domain<IDimSp, IDimVx>(allfdistribu), [&](IndexSpVx const ispvx) {
-            IndexSp isp(ddc::select<IDimSp>(ispvx));
-            IndexVx ivx(ddc::select<IDimVx>(ispvx));
-            IndexSpXVx ispxvx(isp, ix, ivx);
+    IndexSp const iion = find_ion(ddc::get_domain<IDimSp>(allfdistribu));
+    ddc::for_each(
+            ddc::parallel_host_policy(),
+            ddc::get_domain<IDimX>(allfdistribu),
+            [&](IndexX const ix) {
+                DSpanVx const fdistribu_ion = allfdistribu[IndexSpX(iion, ix)];
+                DSpanVx const fdistribu_elec = allfdistribu[IndexSpX(ielec(), ix)];
 
-            double const df
-                    = -m_mask(ix) * amplitudes(isp) * (allfdistribu(ispxvx) - m_ftarget(ivx)) * dt;
-            allfdistribu(ispxvx) = allfdistribu(ispxvx) + df;
-        });
-    });
+                double const decay_ion = m_decay(ix);
+                double const density_ion = m_integrate_v(fdistribu_ion.span_cview());
+                double const density_elec = m_integrate_v(fdistribu_elec.span_cview());
+                double const decay_elec = 1.
+                                          - (density_ion - m_density_target)
+                                                    / (density_elec - m_density_target)
+                                                    * (1. - decay_ion);
+
+                for (IndexVx const ivx : fdistribu_ion.domain()) {
+                    fdistribu_ion(ivx)
+                            = m_ftarget(ivx) + (fdistribu_ion(ivx) - m_ftarget(ivx)) * decay_ion;
+                    fdistribu_elec(ivx)
+                            = m_ftarget(ivx) + (fdistribu_elec(ivx) - m_ftarget(ivx)) * decay_elec;
+                }
+            });
 
     return allfdistribu;
 }
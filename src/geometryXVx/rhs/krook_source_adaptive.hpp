@@ -1,6 +1,7 @@
 #pragma once
 
 #include <geometry.hpp>
+#include <quadrature.hpp>
 
 #include "irighthandside.hpp"
 
@@ -15,6 +16,16 @@ private:
     double m_temperature;
     DFieldX m_mask;
     DFieldVx m_ftarget;
+    Quadrature<IDimVx> m_integrate_v;
+
+    // The density of ftarget computed with the velocity quadrature
+    double m_density_target;
+
+    // The time step for which the decay factors were computed
+    mutable double m_decay_dt;
+
+    // The decay factor exp(-amplitude * mask * dt) of the ions at each point of the spatial grid
+    mutable DFieldX m_decay;
 
 public:
     KrookSourceAdaptive(
@@ -34,5 +45,5 @@ public:
     DSpanSpXVx operator()(DSpanSpXVx allfdistribu, double dt) const override;
 
 private:
-    void get_amplitudes(DSpanSp amplitudes, DViewSpVx allfdistribu) const;
+    IndexSp find_ion(IDomainSp dom_sp) const;
 };
@@ -1,3 +1,4 @@
+#include <cmath>
 #include <stdexcept>
 #include <string>
 
@@ -38,6 +39,8 @@ KrookSourceConstant::KrookSourceConstant(
     , m_density(density)
     , m_temperature(temperature)
     , m_ftarget(gridvx)
+    , m_decay_dt(std::nan(""))
+    , m_decay(gridx)
 {
     // mask that defines the region where the operator is active
     switch (m_type) {
@@ -77,12 +80,24 @@ KrookSourceConstant::KrookSourceConstant(
 
 DSpanSpXVx KrookSourceConstant::operator()(DSpanSpXVx const allfdistribu, double const dt) const
 {
-    ddc::for_each(allfdistribu.domain(), [&](IndexSpXVx const ispxvx) {
-        allfdistribu(ispxvx)
-                = m_ftarget(ddc::select<IDimVx>(ispxvx))
-                  + (allfdistribu(ispxvx) - m_ftarget(ddc::select<IDimVx>(ispxvx)))
-                            * std::exp(-m_amplitude * m_mask(ddc::select<IDimX>(ispxvx)) * dt);
-    });
+    // the decay factors only depend on the time step
+    if (dt != m_decay_dt) {
+        ddc::for_each(m_decay.domain(), [&](IndexX const ix) {
+            m_decay(ix) = std::exp(-m_amplitude * m_mask(ix) * dt);
+        });
+        m_decay_dt = dt;
+    }
+
+    ddc::for_each(
+            ddc::parallel_host_policy(),
+            ddc::get_domain<IDimSp, IDimX>(allfdistribu),
+            [&](IndexSpX const ispx) {
+                double const decay = m_decay(ddc::select<IDimX>(ispx));
+                DSpanVx const fdistribu = allfdistribu[ispx];
+                for (IndexVx const ivx : fdistribu.domain()) {
+                    fdistribu(ivx) = m_ftarget(ivx) + (fdistribu(ivx) - m_ftarget(ivx)) * decay;
+                }
+            });
 
     return allfdistribu;
 }
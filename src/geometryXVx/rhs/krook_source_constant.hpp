@@ -16,6 +16,12 @@ private:
     DFieldX m_mask;
     DFieldVx m_ftarget;
 
+    // The time step for which the decay factors were computed
+    mutable double m_decay_dt;
+
+    // The decay factor exp(-amplitude * mask * dt) at each point of the spatial grid
+    mutable DFieldX m_decay;
+
 public:
     KrookSourceConstant(
             IDomainX const& gridx,
@@ -0,0 +1,102 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <vector>
+
+#include <geometry.hpp>
+
+#include "itimesolver.hpp"
+
+class IPoissonSolver;
+class IBoltzmannSolver;
+
+/**
+ * @brief A predictor-corrector time solver which adapts its time step.
+ *
+ * The predictor-corrector step is the one of PredCorr. Before the corrector is applied, the
+ * electric field given by the predictor at t^{n+1/2} is compared with its linear extrapolation
+ * from the fields at t^n and t^{n-1}. Both are second order estimates so their difference
+ * estimates the local error. On the first sub-step of a call, where the field at t^{n-1} is not
+ * known, the field is extrapolated from t^n and t^{n+1/4} instead, using a shorter predictor.
+ * A step whose error is larger than the tolerance is rejected before the distribution function
+ * is modified, and the next step is grown or shrunk according to the error. A std::runtime_error
+ * is thrown if the tolerance is not met with dt_min. The time step is also limited so that the
+ * displacements of the advections along x and along vx do not exceed cfl cells.
+ *
+ * The time step given to operator() is the interval of simulated time between two outputs and
+ * steps is the number of these intervals. The sub-steps are cut so that the "iteration" events
+ * are triggered exactly at the multiples of this interval, with iter the index of the output.
+ * A sub-step which is cut short to reach an output only advances the time: the next sub-step is
+ * proposed from the uncut one and the field at t^{n-1} is kept from before the cut.
+ *
+ * The step history (the field at t^{n-1}, its age and the proposed step) is kept between two
+ * calls when the second one starts at the time where the first one stopped, so a simulation
+ * advanced in several calls takes the same steps as in a single call. The operator is thus not
+ * reentrant. The history is also exposed as "electric_field_prev", "dt_prev" and "dt_next" with
+ * the "iteration" events so that it can be written with the checkpoints, and set_history()
+ * gives it back to a run restarted from one of them.
+ */
+class AdaptivePredCorr : public ITimeSolver
+{
+private:
+    IBoltzmannSolver const& m_boltzmann_solver;
+
+    IPoissonSolver const& m_poisson_solver;
+
+    double m_dt_min;
+
+    double m_dt_max;
+
+    double m_tolerance;
+
+    double m_cfl;
+
+    // The step history, valid for a call starting at m_history_time on a mesh of the same size
+    mutable double m_history_time;
+
+    mutable double m_dt_prev;
+
+    mutable double m_dt_next;
+
+    mutable std::vector<double> m_electric_field_prev;
+
+public:
+    /**
+     * @brief Create an adaptive predictor-corrector time solver.
+     * @param[in] boltzmann_solver The solver advancing f with a given electric field.
+     * @param[in] poisson_solver The solver computing the electric field.
+     * @param[in] dt_min The smallest allowed time step.
+     * @param[in] dt_max The largest allowed time step.
+     * @param[in] tolerance The tolerance on the error of the field, relative to 1 + max|E|.
+     * @param[in] cfl The largest allowed displacement of the advections, in number of cells.
+     */
+    AdaptivePredCorr(
+            IBoltzmannSolver const& boltzmann_solver,
+            IPoissonSolver const& poisson_solver,
+            double dt_min,
+            double dt_max,
+            double tolerance,
+            double cfl);
+
+    ~AdaptivePredCorr() override = default;
+
+    /**
+     * @brief Set the step history, e.g. the one saved with a checkpoint.
+     * @param[in] time The time of the checkpoint.
+     * @param[in] dt_prev The age of the field at t^{n-1}, saved as "dt_prev", 0 if unknown.
+     * @param[in] dt_next The proposed step, saved as "dt_next".
+     * @param[in] electric_field_prev The field at t^{n-1}, saved as "electric_field_prev".
+     */
+    void set_history(
+            double time,
+            double dt_prev,
+            double dt_next,
+            DViewX electric_field_prev) const;
+
+    DSpanSpXVx operator()(
+            DSpanSpXVx allfdistribu,
+            double dt,
+            int steps = 1,
+            int iter_start = 0) const override;
+};
@@ -0,0 +1,99 @@
+// SPDX-License-Identifier: MIT
+
+#include <ddc/ddc.hpp>
+
+#include <iboltzmannsolver.hpp>
+#include <ipoissonsolver.hpp>
+
+#include "extrapolatedpredcorr.hpp"
+
+ExtrapolatedPredCorr::ExtrapolatedPredCorr(
+        IBoltzmannSolver const& boltzmann_solver,
+        IPoissonSolver const& poisson_solver)
+    : m_boltzmann_solver(boltzmann_solver)
+    , m_poisson_solver(poisson_solver)
+    , m_history_iter(-1)
+    , m_history_dt(0.)
+{
+}
+
+void ExtrapolatedPredCorr::set_history(
+        int const iter,
+        double const dt,
+        DViewX const electric_field_prev) const
+{
+    m_history_iter = iter;
+    m_history_dt = dt;
+    m_electric_field_prev.resize(electric_field_prev.domain().size());
+    ddc::deepcopy(
+            DSpanX(m_electric_field_prev.data(), electric_field_prev.domain()),
+            electric_field_prev);
+}
+
+DSpanSpXVx ExtrapolatedPredCorr::operator()(
+        DSpanSpXVx const allfdistribu,
+        double const dt,
+        int const steps,
+        int const iter_start) const
+{
+    // electrostatic potential and electric field (depending only on x)
+    DFieldX electrostatic_potential(allfdistribu.domain<IDimX>());
+    DFieldX electric_field(allfdistribu.domain<IDimX>());
+    DFieldX electric_field_prev(allfdistribu.domain<IDimX>());
+    DFieldX electric_field_half_t(allfdistribu.domain<IDimX>());
+
+    // continue from the history of the previous call if it stopped where this one starts
+    IDomainX const gridx = allfdistribu.domain<IDimX>();
+    bool const history = iter_start == m_history_iter && dt == m_history_dt
+                         && m_electric_field_prev.size() == gridx.size();
+    if (history) {
+        ddc::deepcopy(electric_field_prev, DViewX(m_electric_field_prev.data(), gridx));
+    }
+
+    int iter = iter_start;
+    for (; iter < iter_start + steps; ++iter) {
+        double const iter_time = iter * dt;
+
+        // computation of the electrostatic potential at time tn and
+        // the associated electric field
+        m_poisson_solver(electrostatic_potential, electric_field, allfdistribu);
+        if (iter == iter_start && !history) {
+            ddc::deepcopy(electric_field_prev, electric_field);
+        }
+
+        ddc::PdiEvent("iteration")
+                .with("iter", iter)
+                .and_with("time_saved", iter_time)
+                .and_with("fdistribu", allfdistribu)
+                .and_with("electrostatic_potential", electrostatic_potential)
+                .and_with("electric_field_prev", electric_field_prev);
+
+        // predictor: extrapolation of the electric field at time tn+1/2
+        if (iter == iter_start && !history) {
+            ddc::deepcopy(electric_field_half_t, electric_field);
+        } else {
+            ddc::for_each(electric_field.domain(), [&](IndexX const ix) {
+                electric_field_half_t(ix)
+                        = 1.5 * electric_field(ix) - 0.5 * electric_field_prev(ix);
+            });
+        }
+        ddc::deepcopy(electric_field_prev, electric_field);
+
+        // correction on a dt
+        m_boltzmann_solver(allfdistribu, electric_field_half_t, dt);
+    }
+
+    if (steps > 0) {
+        set_history(iter, dt, electric_field_prev);
+    }
+
+    double const final_time = iter * dt;
+    m_poisson_solver(electrostatic_potential, electric_field, allfdistribu);
+    ddc::PdiEvent("last_iteration")
+            .with("iter", iter)
+            .and_with("time_saved", final_time)
+            .and_with("fdistribu", allfdistribu)
+            .and_with("electrostatic_potential", electrostatic_potential);
+
+    return allfdistribu;
+}
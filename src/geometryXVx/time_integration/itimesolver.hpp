@@ -9,5 +9,18 @@ class ITimeSolver
 public:
     virtual ~ITimeSolver() = default;
 
-    virtual DSpanSpXVx operator()(DSpanSpXVx allfdistribu, double dt, int steps = 1) const = 0;
+    /**
+     * @brief Advance the distribution function by a number of iterations.
+     * @param[inout] allfdistribu The distribution function.
+     * @param[in] dt The time step.
+     * @param[in] steps The number of iterations.
+     * @param[in] iter_start The index of the first iteration, used when restarting from a
+     *                       checkpoint so that the outputs continue the series of the first run.
+     * @return The distribution function after the iterations.
+     */
+    virtual DSpanSpXVx operator()(
+            DSpanSpXVx allfdistribu,
+            double dt,
+            int steps = 1,
+            int iter_start = 0) const = 0;
 };
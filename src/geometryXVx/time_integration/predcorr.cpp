@@ -13,11 +13,38 @@
 PredCorr::PredCorr(IBoltzmannSolver const& boltzmann_solver, IPoissonSolver const& poisson_solver)
     : m_boltzmann_solver(boltzmann_solver)
     , m_poisson_solver(poisson_solver)
+    , m_output(nullptr)
+    , m_diagnostics(nullptr)
 {
 }
 
-DSpanSpXVx PredCorr::operator()(DSpanSpXVx const allfdistribu, double const dt, int const steps)
-        const
+PredCorr::PredCorr(
+        IBoltzmannSolver const& boltzmann_solver,
+        IPoissonSolver const& poisson_solver,
+        AsyncPdiWriter<IDomainSpXVx, IDomainX>& output)
+    : m_boltzmann_solver(boltzmann_solver)
+    , m_poisson_solver(poisson_solver)
+    , m_output(&output)
+    , m_diagnostics(nullptr)
+{
+}
+
+PredCorr::PredCorr(
+        IBoltzmannSolver const& boltzmann_solver,
+        IPoissonSolver const& poisson_solver,
+        ReducedDiagnostics const& diagnostics)
+    : m_boltzmann_solver(boltzmann_solver)
+    , m_poisson_solver(poisson_solver)
+    , m_output(nullptr)
+    , m_diagnostics(&diagnostics)
+{
+}
+
+DSpanSpXVx PredCorr::operator()(
+        DSpanSpXVx const allfdistribu,
+        double const dt,
+        int const steps,
+        int const iter_start) const
 {
     // electrostatic potential and electric field (depending only on x)
     DFieldX electrostatic_potential(allfdistribu.domain<IDimX>());
@@ -28,19 +55,23 @@ DSpanSpXVx PredCorr::operator()(DSpanSpXVx const allfdistribu, double const dt,
 
     m_poisson_solver(electrostatic_potential, electric_field, allfdistribu);
 
-    int iter = 0;
-    for (; iter < steps; ++iter) {
+    int iter = iter_start;
+    for (; iter < iter_start + steps; ++iter) {
         double const iter_time = iter * dt;
 
         // computation of the electrostatic potential at time tn and
         // the associated electric field
         m_poisson_solver(electrostatic_potential, electric_field, allfdistribu);
 
-        ddc::PdiEvent("iteration")
-                .with("iter", iter)
-                .and_with("time_saved", iter_time)
-                .and_with("fdistribu", allfdistribu)
-                .and_with("electrostatic_potential", electrostatic_potential);
+        output("iteration", iter, iter_time, allfdistribu, electrostatic_potential);
+        if (m_diagnostics) {
+            (*m_diagnostics)(
+                    iter,
+                    iter_time,
+                    allfdistribu,
+                    electrostatic_potential,
+                    electric_field);
+        }
 
         // copy fdistribu
         ddc::deepcopy(allfdistribu_half_t, allfdistribu);
@@ -57,11 +88,28 @@ DSpanSpXVx PredCorr::operator()(DSpanSpXVx const allfdistribu, double const dt,
 
     double const final_time = iter * dt;
     m_poisson_solver(electrostatic_potential, electric_field, allfdistribu);
-    ddc::PdiEvent("last_iteration")
-            .with("iter", iter)
-            .and_with("time_saved", final_time)
-            .and_with("fdistribu", allfdistribu)
-            .and_with("electrostatic_potential", electrostatic_potential);
+    output("last_iteration", iter, final_time, allfdistribu, electrostatic_potential);
+    if (m_diagnostics) {
+        (*m_diagnostics)(iter, final_time, allfdistribu, electrostatic_potential, electric_field);
+    }
 
     return allfdistribu;
 }
+
+void PredCorr::output(
+        std::string const& event,
+        int const iter,
+        double const time_saved,
+        DSpanSpXVx const allfdistribu,
+        DSpanX const electrostatic_potential) const
+{
+    if (m_output) {
+        (*m_output)(event, iter, time_saved, allfdistribu, electrostatic_potential);
+    } else {
+        ddc::PdiEvent(event)
+                .with("iter", iter)
+                .and_with("time_saved", time_saved)
+                .and_with("fdistribu", allfdistribu)
+                .and_with("electrostatic_potential", electrostatic_potential);
+    }
+}
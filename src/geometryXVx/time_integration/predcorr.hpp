@@ -2,7 +2,11 @@
 
 #pragma once
 
+#include <string>
+
+#include <async_pdi_writer.hpp>
 #include <geometry.hpp>
+#include <reduced_diagnostics.hpp>
 
 #include "itimesolver.hpp"
 
@@ -16,10 +20,49 @@ private:
 
     IPoissonSolver const& m_poisson_solver;
 
+    AsyncPdiWriter<IDomainSpXVx, IDomainX>* m_output;
+
+    ReducedDiagnostics const* m_diagnostics;
+
 public:
     PredCorr(IBoltzmannSolver const& boltzmann_solver, IPoissonSolver const& poisson_solver);
 
+    /**
+     * @brief Create a predictor-corrector whose outputs are written asynchronously.
+     * @param[in] boltzmann_solver The solver advancing the distribution function.
+     * @param[in] poisson_solver The solver computing the electric field.
+     * @param[in] output The writer which triggers the output events from a background thread.
+     */
+    PredCorr(
+            IBoltzmannSolver const& boltzmann_solver,
+            IPoissonSolver const& poisson_solver,
+            AsyncPdiWriter<IDomainSpXVx, IDomainX>& output);
+
+    /**
+     * @brief Create a predictor-corrector which computes reduced diagnostics at each iteration.
+     * @param[in] boltzmann_solver The solver advancing the distribution function.
+     * @param[in] poisson_solver The solver computing the electric field.
+     * @param[in] diagnostics The diagnostics computed from the state at the start of each
+     *            iteration and at the end of the simulation.
+     */
+    PredCorr(
+            IBoltzmannSolver const& boltzmann_solver,
+            IPoissonSolver const& poisson_solver,
+            ReducedDiagnostics const& diagnostics);
+
     ~PredCorr() override = default;
 
-    DSpanSpXVx operator()(DSpanSpXVx allfdistribu, double dt, int steps = 1) const override;
+    DSpanSpXVx operator()(
+            DSpanSpXVx allfdistribu,
+            double dt,
+            int steps = 1,
+            int iter_start = 0) const override;
+
+private:
+    void output(
+            std::string const& event,
+            int iter,
+            double time_saved,
+            DSpanSpXVx allfdistribu,
+            DSpanX electrostatic_potential) const;
 };
@@ -0,0 +1,133 @@
+// SPDX-License-Identifier: MIT
+
+#include <cassert>
+#include <cmath>
+
+#include <ddc/ddc.hpp>
+
+#include <iadvectionvx.hpp>
+#include <iadvectionx.hpp>
+#include <ipoissonsolver.hpp>
+
+#include "symplecticsplitting.hpp"
+
+SymplecticSplitting::SymplecticSplitting(
+        IAdvectionSpatial<GeometryXVx, IDimX> const& advec_x,
+        IAdvectionVelocity<GeometryXVx, IDimVx> const& advec_vx,
+        IPoissonSolver const& poisson_solver,
+        SplittingScheme const scheme)
+    : m_advec_x(advec_x)
+    , m_advec_vx(advec_vx)
+    , m_poisson_solver(poisson_solver)
+    , m_output(nullptr)
+    , m_diagnostics(nullptr)
+{
+    switch (scheme) {
+    case SplittingScheme::Ruth3:
+        m_coeffs_x = {0., -1. / 24., 3. / 4., 7. / 24.};
+        m_coeffs_vx = {1., -2. / 3., 2. / 3., 0.};
+        break;
+    case SplittingScheme::Yoshida4: {
+        double const w1 = 1. / (2. - std::cbrt(2.));
+        double const w0 = -std::cbrt(2.) / (2. - std::cbrt(2.));
+        m_coeffs_x = {w1 / 2., (w0 + w1) / 2., (w0 + w1) / 2., w1 / 2.};
+        m_coeffs_vx = {w1, w0, w1, 0.};
+        break;
+    }
+    }
+    assert(m_coeffs_x.size() == m_coeffs_vx.size());
+}
+
+SymplecticSplitting::SymplecticSplitting(
+        IAdvectionSpatial<GeometryXVx, IDimX> const& advec_x,
+        IAdvectionVelocity<GeometryXVx, IDimVx> const& advec_vx,
+        IPoissonSolver const& poisson_solver,
+        SplittingScheme const scheme,
+        AsyncPdiWriter<IDomainSpXVx, IDomainX>& output)
+    : SymplecticSplitting(advec_x, advec_vx, poisson_solver, scheme)
+{
+    m_output = &output;
+}
+
+SymplecticSplitting::SymplecticSplitting(
+        IAdvectionSpatial<GeometryXVx, IDimX> const& advec_x,
+        IAdvectionVelocity<GeometryXVx, IDimVx> const& advec_vx,
+        IPoissonSolver const& poisson_solver,
+        SplittingScheme const scheme,
+        ReducedDiagnostics const& diagnostics)
+    : SymplecticSplitting(advec_x, advec_vx, poisson_solver, scheme)
+{
+    m_diagnostics = &diagnostics;
+}
+
+DSpanSpXVx SymplecticSplitting::operator()(
+        DSpanSpXVx const allfdistribu,
+        double const dt,
+        int const steps,
+        int const iter_start) const
+{
+    // electrostatic potential and electric field (depending only on x)
+    DFieldX electrostatic_potential(allfdistribu.domain<IDimX>());
+    DFieldX electric_field(allfdistribu.domain<IDimX>());
+
+    int iter = iter_start;
+    for (; iter < iter_start + steps; ++iter) {
+        double const iter_time = iter * dt;
+
+        // computation of the electrostatic potential at time tn
+        m_poisson_solver(electrostatic_potential, electric_field, allfdistribu);
+
+        output("iteration", iter, iter_time, allfdistribu, electrostatic_potential);
+        if (m_diagnostics) {
+            (*m_diagnostics)(
+                    iter,
+                    iter_time,
+                    allfdistribu,
+                    electrostatic_potential,
+                    electric_field);
+        }
+
+        // the electric field only changes with the advections along x
+        bool field_up_to_date = true;
+        for (std::size_t stage = 0; stage < m_coeffs_x.size(); ++stage) {
+            if (m_coeffs_x[stage] != 0.) {
+                m_advec_x(allfdistribu, m_coeffs_x[stage] * dt);
+                field_up_to_date = false;
+            }
+            if (m_coeffs_vx[stage] != 0.) {
+                if (!field_up_to_date) {
+                    m_poisson_solver(electrostatic_potential, electric_field, allfdistribu);
+                    field_up_to_date = true;
+                }
+                m_advec_vx(allfdistribu, electric_field, m_coeffs_vx[stage] * dt);
+            }
+        }
+    }
+
+    double const final_time = iter * dt;
+    m_poisson_solver(electrostatic_potential, electric_field, allfdistribu);
+    output("last_iteration", iter, final_time, allfdistribu, electrostatic_potential);
+    if (m_diagnostics) {
+        (*m_diagnostics)(iter, final_time, allfdistribu, electrostatic_potential, electric_field);
+    }
+
+    return allfdistribu;
+}
+
+void SymplecticSplitting::output(
+        std::string const& event,
+        int const iter,
+        double const time_saved,
+        DSpanSpXVx const allfdistribu,
+        DSpanX const electrostatic_potential) const
+{
+    if (m_output) {
+        (*m_output)(event, iter, time_saved, allfdistribu, electrostatic_potential);
+    } else {
+        ddc::PdiEvent(event)
+                .with("iter", iter)
+                .and_with("time_saved", time_saved)
+                .and_with("fdistribu", allfdistribu)
+                .and_with("electrostatic_potential", electrostatic_potential);
+    }
+}
@@ -0,0 +1,112 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include <async_pdi_writer.hpp>
+#include <geometry.hpp>
+#include <reduced_diagnostics.hpp>
+
+#include "itimesolver.hpp"
+
+class IPoissonSolver;
+template <class Geometry, class DDimX>
+class IAdvectionSpatial;
+template <class Geometry, class DDimV>
+class IAdvectionVelocity;
+
+/**
+ * The high order splitting schemes which can be used by SymplecticSplitting.
+ * - Ruth3: the third order scheme of Ruth with 3 stages,
+ * - Yoshida4: the fourth order scheme of Yoshida with 3 stages.
+ */
+enum class SplittingScheme { Ruth3, Yoshida4 };
+
+/**
+ * @brief A time solver composing the free streaming and the acceleration of the Vlasov-Poisson
+ * system with the coefficients of a high order symplectic splitting scheme.
+ *
+ * Each stage is made of an advection along x followed by an advection along vx. The electric
+ * field is computed from the distribution function just before each advection along vx. As this
+ * advection does not change the density, the field is constant during the stage, so both flows
+ * are solved exactly in time and the order of the time solver is the order of the splitting.
+ *
+ * @warning The stages only call the advection operators, they do not go through an
+ * IBoltzmannSolver. The scheme therefore solves the collisionless Vlasov-Poisson system without
+ * any source: the collisions, the Krook operators and the kinetic sources configured in a
+ * simulation are NOT applied. Simulations with such terms must use PredCorr.
+ */
+class SymplecticSplitting : public ITimeSolver
+{
+private:
+    IAdvectionSpatial<GeometryXVx, IDimX> const& m_advec_x;
+
+    IAdvectionVelocity<GeometryXVx, IDimVx> const& m_advec_vx;
+
+    IPoissonSolver const& m_poisson_solver;
+
+    // The fractions of the time step of the advections along x and along vx of each stage
+    std::vector<double> m_coeffs_x;
+
+    std::vector<double> m_coeffs_vx;
+
+    AsyncPdiWriter<IDomainSpXVx, IDomainX>* m_output;
+
+    ReducedDiagnostics const* m_diagnostics;
+
+public:
+    SymplecticSplitting(
+            IAdvectionSpatial<GeometryXVx, IDimX> const& advec_x,
+            IAdvectionVelocity<GeometryXVx, IDimVx> const& advec_vx,
+            IPoissonSolver const& poisson_solver,
+            SplittingScheme scheme);
+
+    /**
+     * @brief Create a splitting scheme whose outputs are written asynchronously.
+     * @param[in] advec_x The advection operator along x.
+     * @param[in] advec_vx The advection operator along vx.
+     * @param[in] poisson_solver The solver computing the electric field.
+     * @param[in] scheme The coefficients of the splitting.
+     * @param[in] output The writer which triggers the output events from a background thread.
+     */
+    SymplecticSplitting(
+            IAdvectionSpatial<GeometryXVx, IDimX> const& advec_x,
+            IAdvectionVelocity<GeometryXVx, IDimVx> const& advec_vx,
+            IPoissonSolver const& poisson_solver,
+            SplittingScheme scheme,
+            AsyncPdiWriter<IDomainSpXVx, IDomainX>& output);
+
+    /**
+     * @brief Create a splitting scheme which computes reduced diagnostics at each iteration.
+     * @param[in] advec_x The advection operator along x.
+     * @param[in] advec_vx The advection operator along vx.
+     * @param[in] poisson_solver The solver computing the electric field.
+     * @param[in] scheme The coefficients of the splitting.
+     * @param[in] diagnostics The diagnostics computed from the state at the start of each
+     *            iteration and at the end of the simulation.
+     */
+    SymplecticSplitting(
+            IAdvectionSpatial<GeometryXVx, IDimX> const& advec_x,
+            IAdvectionVelocity<GeometryXVx, IDimVx> const& advec_vx,
+            IPoissonSolver const& poisson_solver,
+            SplittingScheme scheme,
+            ReducedDiagnostics const& diagnostics);
+
+    ~SymplecticSplitting() override = default;
+
+    DSpanSpXVx operator()(
+            DSpanSpXVx allfdistribu,
+            double dt,
+            int steps = 1,
+            int iter_start = 0) const override;
+
+private:
+    void output(
+            std::string const& event,
+            int iter,
+            double time_saved,
+            DSpanSpXVx allfdistribu,
+            DSpanX electrostatic_potential) const;
+};
@@ -1,11 +1,44 @@
 // SPDX-License-Identifier: MIT
 
+#include <cmath>
+
 #include <ddc/ddc.hpp>
 
 #include <fluid_moments.hpp>
 #include <quadrature.hpp>
 #include <trapezoid_quadrature.hpp>
 
+namespace {
+
+/**
+ * A sum with a running compensation of the rounding errors (Kahan-Babuska-Neumaier).
+ */
+class CompensatedSum
+{
+private:
+    double m_sum = 0.;
+    double m_compensation = 0.;
+
+public:
+    void operator+=(double const value)
+    {
+        double const sum = m_sum + value;
+        if (std::fabs(m_sum) >= std::fabs(value)) {
+            m_compensation += (m_sum - sum) + value;
+        } else {
+            m_compensation += (value - sum) + m_sum;
+        }
+        m_sum = sum;
+    }
+
+    double value() const
+    {
+        return m_sum + m_compensation;
+    }
+};
+
+} // namespace
+
 FluidMoments::FluidMoments(Quadrature<IDimVx> integrate_v) : m_integrate_v(std::move(integrate_v))
 {
 }
@@ -40,13 +73,13 @@ void FluidMoments::operator()(
         double const& density,
         FluidMoments::MomentVelocity)
 {
-    DFieldVx integrand(fdistribu.domain());
-    ddc::for_each(fdistribu.domain(), [&](IndexVx const ivx) {
-        CoordVx const coordv = ddc::coordinate(ivx);
-        integrand(ivx) = coordv * fdistribu(ivx);
-    });
+    DViewVx const coeffs = m_integrate_v.coefficients();
+    double momentum = 0.;
+    for (IndexVx const ivx : fdistribu.domain()) {
+        momentum += coeffs(ivx) * ddc::coordinate(ivx) * fdistribu(ivx);
+    }
 
-    mean_velocity = m_integrate_v(integrand) / density;
+    mean_velocity = momentum / density;
 }
 /*
  * Computes the mean_velocity of allfdistribu, using its density
@@ -57,14 +90,8 @@ void FluidMoments::operator()(
         DViewSpX const density,
         FluidMoments::MomentVelocity)
 {
-    DFieldSpXVx integrand(allfdistribu.domain());
-    ddc::for_each(allfdistribu.domain(), [&](IndexSpXVx const ispxvx) {
-        CoordVx const coordv = ddc::coordinate(ddc::select<IDimVx>(ispxvx));
-        integrand(ispxvx) = coordv * allfdistribu(ispxvx);
-    });
-
     ddc::for_each(ddc::get_domain<IDimSp, IDimX>(allfdistribu), [&](IndexSpX const ispx) {
-        mean_velocity(ispx) = m_integrate_v(integrand[ispx]) / density(ispx);
+        (*this)(mean_velocity(ispx), allfdistribu[ispx], density(ispx), FluidMoments::s_velocity);
     });
 }
 
@@ -78,13 +105,14 @@ void FluidMoments::operator()(
         double const& mean_velocity,
         FluidMoments::MomentTemperature)
 {
-    DFieldVx integrand(fdistribu.domain());
-    ddc::for_each(fdistribu.domain(), [&](IndexVx const ivx) {
-        double const coeff = ddc::coordinate(ddc::select<IDimVx>(ivx)) - mean_velocity;
-        integrand(ivx) = coeff * coeff * fdistribu(ivx);
-    });
+    DViewVx const coeffs = m_integrate_v.coefficients();
+    double pressure = 0.;
+    for (IndexVx const ivx : fdistribu.domain()) {
+        double const coeff = ddc::coordinate(ivx) - mean_velocity;
+        pressure += coeffs(ivx) * coeff * coeff * fdistribu(ivx);
+    }
 
-    temperature = m_integrate_v(integrand) / density;
+    temperature = pressure / density;
 }
 /*
  * Computes the temperature of allfdistribu, using its density and mean velocity
@@ -96,14 +124,127 @@ void FluidMoments::operator()(
         DViewSpX const mean_velocity,
         FluidMoments::MomentTemperature)
 {
-    DFieldSpXVx integrand(allfdistribu.domain());
-    ddc::for_each(allfdistribu.domain(), [&](IndexSpXVx const ispxvx) {
-        double const coeff = ddc::coordinate(ddc::select<IDimVx>(ispxvx))
-                             - mean_velocity(ddc::select<IDimSp, IDimX>(ispxvx));
-        integrand(ispxvx) = coeff * coeff * allfdistribu(ispxvx);
-    });
-
     ddc::for_each(ddc::get_domain<IDimSp, IDimX>(allfdistribu), [&](IndexSpX const ispx) {
-        temperature(ispx) = m_integrate_v(integrand[ispx]) / density(ispx);
+        (*this)(temperature(ispx),
+                allfdistribu[ispx],
+                density(ispx),
+                mean_velocity(ispx),
+                FluidMoments::s_temperature);
     });
 }
+
+/*
+ * Computes the density, mean velocity, temperature and, if heat_flux is not null, the heat flux
+ * 1/2 \int (v-u)^3 f dv of fdistribu.
+ * The line is read once from memory to compute the density and the mean velocity, the central
+ * moments are then computed while it is still in cache. The sums are compensated.
+*/
+void FluidMoments::compute_all(
+        double& density,
+        double& mean_velocity,
+        double& temperature,
+        double* const heat_flux,
+        DViewVx const fdistribu) const
+{
+    DViewVx const coeffs = m_integrate_v.coefficients();
+    IDomainVx const gridvx = fdistribu.domain();
+
+    CompensatedSum density_sum;
+    CompensatedSum momentum_sum;
+    for (IndexVx const ivx : gridvx) {
+        double const weighted_f = coeffs(ivx) * fdistribu(ivx);
+        density_sum += weighted_f;
+        momentum_sum += weighted_f * ddc::coordinate(ivx);
+    }
+    density = density_sum.value();
+    mean_velocity = momentum_sum.value() / density;
+
+    CompensatedSum pressure_sum;
+    CompensatedSum heat_flux_sum;
+    for (IndexVx const ivx : gridvx) {
+        double const term_v = ddc::coordinate(ivx) - mean_velocity;
+        double const weighted_term = coeffs(ivx) * term_v * term_v * fdistribu(ivx);
+        pressure_sum += weighted_term;
+        if (heat_flux) {
+            heat_flux_sum += weighted_term * term_v;
+        }
+    }
+    temperature = pressure_sum.value() / density;
+    if (heat_flux) {
+        *heat_flux = 0.5 * heat_flux_sum.value();
+    }
+}
+
+/*
+ * Computes the density, mean velocity and temperature of fdistribu
+*/
+void FluidMoments::operator()(
+        double& density,
+        double& mean_velocity,
+        double& temperature,
+        DViewVx const fdistribu,
+        FluidMoments::MomentAll) const
+{
+    compute_all(density, mean_velocity, temperature, nullptr, fdistribu);
+}
+
+/*
+ * Computes the density, mean velocity, temperature and heat flux of fdistribu
+*/
+void FluidMoments::operator()(
+        double& density,
+        double& mean_velocity,
+        double& temperature,
+        double& heat_flux,
+        DViewVx const fdistribu,
+        FluidMoments::MomentAll) const
+{
+    compute_all(density, mean_velocity, temperature, &heat_flux, fdistribu);
+}
+
+/*
+ * Computes the density, mean velocity and temperature of allfdistribu
+*/
+void FluidMoments::operator()(
+        DSpanSpX const density,
+        DSpanSpX const mean_velocity,
+        DSpanSpX const temperature,
+        DViewSpXVx const allfdistribu,
+        FluidMoments::MomentAll) const
+{
+    ddc::for_each(
+            ddc::parallel_host_policy(),
+            ddc::get_domain<IDimSp, IDimX>(allfdistribu),
+            [&](IndexSpX const ispx) {
+                compute_all(
+                        density(ispx),
+                        mean_velocity(ispx),
+                        temperature(ispx),
+                        nullptr,
+                        allfdistribu[ispx]);
+            });
+}
+
+/*
+ * Computes the density, mean velocity, temperature and heat flux of allfdistribu
+*/
+void FluidMoments::operator()(
+        DSpanSpX const density,
+        DSpanSpX const mean_velocity,
+        DSpanSpX const temperature,
+        DSpanSpX const heat_flux,
+        DViewSpXVx const allfdistribu,
+        FluidMoments::MomentAll) const
+{
+    ddc::for_each(
+            ddc::parallel_host_policy(),
+            ddc::get_domain<IDimSp, IDimX>(allfdistribu),
+            [&](IndexSpX const ispx) {
+                compute_all(
+                        density(ispx),
+                        mean_velocity(ispx),
+                        temperature(ispx),
+                        &heat_flux(ispx),
+                        allfdistribu[ispx]);
+            });
+}
@@ -8,6 +8,8 @@
 /**
  * Computes fluid moments of the distribution function 
  * Density, mean velocity and temperature.
+ * The MomentAll overloads compute the density, the mean velocity, the temperature and
+ * optionally the heat flux together, reading each velocity line only once from memory.
  */
 class FluidMoments
 {
@@ -27,9 +29,14 @@ public:
     {
     };
 
+    struct MomentAll
+    {
+    };
+
     static constexpr MomentDensity s_density = MomentDensity();
     static constexpr MomentVelocity s_velocity = MomentVelocity();
     static constexpr MomentTemperature s_temperature = MomentTemperature();
+    static constexpr MomentAll s_all = MomentAll();
 
     FluidMoments(Quadrature<IDimVx> integrate_v);
 
@@ -64,4 +71,42 @@ public:
             DViewSpX density,
             DViewSpX mean_velocity,
             MomentTemperature);
+
+    void operator()(
+            double& density,
+            double& mean_velocity,
+            double& temperature,
+            DViewVx fdistribu,
+            MomentAll) const;
+
+    void operator()(
+            double& density,
+            double& mean_velocity,
+            double& temperature,
+            double& heat_flux,
+            DViewVx fdistribu,
+            MomentAll) const;
+
+    void operator()(
+            DSpanSpX density,
+            DSpanSpX mean_velocity,
+            DSpanSpX temperature,
+            DViewSpXVx allfdistribu,
+            MomentAll) const;
+
+    void operator()(
+            DSpanSpX density,
+            DSpanSpX mean_velocity,
+            DSpanSpX temperature,
+            DSpanSpX heat_flux,
+            DViewSpXVx allfdistribu,
+            MomentAll) const;
+
+private:
+    void compute_all(
+            double& density,
+            double& mean_velocity,
+            double& temperature,
+            double* heat_flux,
+            DViewVx fdistribu) const;
 };
@@ -0,0 +1,167 @@
+// SPDX-License-Identifier: MIT
+
+#include <cmath>
+#include <stdexcept>
+
+#include <ddc/ddc.hpp>
+#include <ddc/pdi.hpp>
+
+#include <trapezoid_quadrature.hpp>
+
+#include "reduced_diagnostics.hpp"
+
+ReducedDiagnostics::ReducedDiagnostics(
+        IDomainSpXVx const& dom,
+        int const nbstep_scalars,
+        int const nbstep_profiles,
+        int const nb_modes)
+    : m_nbstep_scalars(nbstep_scalars)
+    , m_nbstep_profiles(nbstep_profiles)
+    , m_integrate_x(trapezoid_quadrature_coefficients(ddc::select<IDimX>(dom)))
+    , m_quadrature_coeffs_v(trapezoid_quadrature_coefficients(ddc::select<IDimVx>(dom)))
+    , m_moments(Quadrature<IDimVx>(trapezoid_quadrature_coefficients(ddc::select<IDimVx>(dom))))
+    , m_density(ddc::select<IDimSp, IDimX>(dom))
+    , m_mean_velocity(ddc::select<IDimSp, IDimX>(dom))
+    , m_temperature(ddc::select<IDimSp, IDimX>(dom))
+    , m_heat_flux(ddc::select<IDimSp, IDimX>(dom))
+    , m_particle_flux(ddc::select<IDimSp, IDimX>(dom))
+    , m_kinetic_energy_density(ddc::select<IDimSp, IDimX>(dom))
+    , m_kinetic_energy(ddc::select<IDimSp>(dom))
+    , m_particle_flux_left(ddc::select<IDimSp>(dom))
+    , m_particle_flux_right(ddc::select<IDimSp>(dom))
+    , m_energy_flux_left(ddc::select<IDimSp>(dom))
+    , m_energy_flux_right(ddc::select<IDimSp>(dom))
+    , m_field_energy(0.)
+    , m_modes(ddc::DiscreteDomain<IDimMode>(
+              ddc::DiscreteElement<IDimMode>(0),
+              ddc::DiscreteVector<IDimMode>(nb_modes)))
+    , m_potential_modes(m_modes.domain())
+{
+    if (!RDimX::PERIODIC && nb_modes > 0) {
+        throw std::invalid_argument(
+                "The Fourier modes of the electrostatic potential require a periodic x.");
+    }
+    if (nb_modes < 0 || nb_modes > int(ddc::select<IDimX>(dom).size() / 2 + 1)) {
+        throw std::invalid_argument(
+                "The number of Fourier modes should be between 0 and Nx/2+1.");
+    }
+    for (ddc::DiscreteElement<IDimMode> const imode : m_modes.domain()) {
+        m_modes(imode) = imode.uid();
+    }
+}
+
+void ReducedDiagnostics::operator()(
+        int const iter,
+        double const time_saved,
+        DViewSpXVx const allfdistribu,
+        DViewX const electrostatic_potential,
+        DViewX const electric_field) const
+{
+    if (m_nbstep_scalars > 0 && iter % m_nbstep_scalars == 0) {
+        compute_scalars(allfdistribu, electrostatic_potential, electric_field);
+
+        ddc::PdiEvent("scalar_diagnostics")
+                .with("iter", iter)
+                .and_with("time_saved", time_saved)
+                .and_with("field_energy", m_field_energy)
+                .and_with("kinetic_energy", m_kinetic_energy)
+                .and_with("electrostatic_potential_modes", m_potential_modes)
+                .and_with("particle_flux_left", m_particle_flux_left)
+                .and_with("particle_flux_right", m_particle_flux_right)
+                .and_with("energy_flux_left", m_energy_flux_left)
+                .and_with("energy_flux_right", m_energy_flux_right);
+    }
+
+    if (m_nbstep_profiles > 0 && iter % m_nbstep_profiles == 0) {
+        compute_profiles(allfdistribu);
+
+        ddc::PdiEvent("profile_diagnostics")
+                .with("iter", iter)
+                .and_with("time_saved", time_saved)
+                .and_with("density", m_density)
+                .and_with("mean_velocity", m_mean_velocity)
+                .and_with("temperature", m_temperature)
+                .and_with("particle_flux", m_particle_flux)
+                .and_with("heat_flux", m_heat_flux);
+    }
+}
+
+void ReducedDiagnostics::compute_scalars(
+        DViewSpXVx const allfdistribu,
+        DViewX const electrostatic_potential,
+        DViewX const electric_field) const
+{
+    IDomainSp const dom_sp = allfdistribu.domain<IDimSp>();
+    IDomainX const gridx = allfdistribu.domain<IDimX>();
+
+    // kinetic energy, integrated along v for each (species, x) then along x
+    ddc::for_each(
+            ddc::parallel_host_policy(),
+            ddc::get_domain<IDimSp, IDimX>(allfdistribu),
+            [&](IndexSpX const ispx) {
+                double energy = 0.;
+                for (IndexVx const ivx : allfdistribu.domain<IDimVx>()) {
+                    double const v = ddc::coordinate(ivx);
+                    energy += m_quadrature_coeffs_v(ivx) * v * v * allfdistribu(ispx, ivx);
+                }
+                m_kinetic_energy_density(ispx) = 0.5 * energy;
+            });
+    for (IndexSp const isp : dom_sp) {
+        m_kinetic_energy(isp) = m_integrate_x(m_kinetic_energy_density[isp]);
+    }
+
+    // particle and energy fluxes through the boundaries of the domain
+    for (IndexSp const isp : dom_sp) {
+        m_particle_flux_left(isp) = 0.;
+        m_particle_flux_right(isp) = 0.;
+        m_energy_flux_left(isp) = 0.;
+        m_energy_flux_right(isp) = 0.;
+        for (IndexVx const ivx : allfdistribu.domain<IDimVx>()) {
+            double const v = ddc::coordinate(ivx);
+            double const flux_left = m_quadrature_coeffs_v(ivx) * v
+                                      * allfdistribu(isp, gridx.front(), ivx);
+            double const flux_right = m_quadrature_coeffs_v(ivx) * v
+                                       * allfdistribu(isp, gridx.back(), ivx);
+            m_particle_flux_left(isp) += flux_left;
+            m_particle_flux_right(isp) += flux_right;
+            m_energy_flux_left(isp) += 0.5 * v * v * flux_left;
+            m_energy_flux_right(isp) += 0.5 * v * v * flux_right;
+        }
+    }
+
+    // amplitudes of the Fourier modes of the electrostatic potential
+    double const nx = gridx.size();
+    for (ddc::DiscreteElement<IDimMode> const imode : m_potential_modes.domain()) {
+        double const k = 2. * M_PI * m_modes(imode) / nx;
+        double real = 0.;
+        double imag = 0.;
+        for (IndexX const ix : gridx) {
+            double const phase = k * (ix - gridx.front()).value();
+            real += electrostatic_potential(ix) * std::cos(phase);
+            imag -= electrostatic_potential(ix) * std::sin(phase);
+        }
+        m_potential_modes(imode) = std::sqrt(real * real + imag * imag) / nx;
+    }
+
+    // energy of the electric field
+    DViewX const coeffs_x = m_integrate_x.coefficients();
+    double field_energy = 0.;
+    for (IndexX const ix : gridx) {
+        field_energy += coeffs_x(ix) * electric_field(ix) * electric_field(ix);
+    }
+    m_field_energy = 0.5 * field_energy;
+}
+
+void ReducedDiagnostics::compute_profiles(DViewSpXVx const allfdistribu) const
+{
+    m_moments(
+            m_density,
+            m_mean_velocity,
+            m_temperature,
+            m_heat_flux,
+            allfdistribu,
+            FluidMoments::s_all);
+    ddc::for_each(ddc::get_domain<IDimSp, IDimX>(allfdistribu), [&](IndexSpX const ispx) {
+        m_particle_flux(ispx) = m_density(ispx) * m_mean_velocity(ispx);
+    });
+}
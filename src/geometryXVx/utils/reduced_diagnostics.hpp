@@ -0,0 +1,207 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <geometry.hpp>
+#include <quadrature.hpp>
+
+#include "fluid_moments.hpp"
+
+/**
+ * @brief A class computing reduced diagnostics of the simulation while it runs.
+ *
+ * Two groups of diagnostics are computed, each with its own period in iterations:
+ * - the scalars: the electric field energy, the kinetic energy of each species, the amplitudes
+ *   of the first Fourier modes of the electrostatic potential and the particle and energy fluxes
+ *   of each species at the two boundaries of the domain, given to PDI with the
+ *   "scalar_diagnostics" event;
+ * - the profiles: the density, the mean velocity, the temperature, the particle flux and the
+ *   heat flux of each species along x, given to PDI with the "profile_diagnostics" event.
+ *
+ * The heat flux of the profiles is the central moment 0.5 * int (v-u)^3 f dv, while the energy
+ * flux at the boundaries is 0.5 * int v^3 f dv, and the kinetic energy is
+ * 0.5 * int int v^2 f dv dx, all in the velocity normalisation of each species. The Fourier
+ * modes are computed by a discrete Fourier transform of the values of the potential, which
+ * assumes a uniform periodic mesh, so they are only available when x is periodic.
+ */
+class ReducedDiagnostics
+{
+public:
+    /// The discrete dimension of the Fourier modes of the electrostatic potential.
+    struct IDimMode
+    {
+    };
+
+private:
+    int m_nbstep_scalars;
+
+    int m_nbstep_profiles;
+
+    Quadrature<IDimX> m_integrate_x;
+
+    DFieldVx m_quadrature_coeffs_v;
+
+    FluidMoments m_moments;
+
+    mutable DFieldSpX m_density;
+
+    mutable DFieldSpX m_mean_velocity;
+
+    mutable DFieldSpX m_temperature;
+
+    mutable DFieldSpX m_heat_flux;
+
+    mutable DFieldSpX m_particle_flux;
+
+    mutable DFieldSpX m_kinetic_energy_density;
+
+    mutable DFieldSp m_kinetic_energy;
+
+    mutable DFieldSp m_particle_flux_left;
+
+    mutable DFieldSp m_particle_flux_right;
+
+    mutable DFieldSp m_energy_flux_left;
+
+    mutable DFieldSp m_energy_flux_right;
+
+    mutable double m_field_energy;
+
+    ddc::Chunk<int, ddc::DiscreteDomain<IDimMode>> m_modes;
+
+    mutable ddc::Chunk<double, ddc::DiscreteDomain<IDimMode>> m_potential_modes;
+
+public:
+    /**
+     * @brief Create the reduced diagnostics.
+     * @param[in] dom The domain of the distribution function.
+     * @param[in] nbstep_scalars The number of iterations between two computations of the
+     *            scalars, no scalar is computed if it is not positive.
+     * @param[in] nbstep_profiles The number of iterations between two computations of the
+     *            profiles, no profile is computed if it is not positive.
+     * @param[in] nb_modes The number of Fourier modes of the electrostatic potential whose
+     *            amplitude is computed, starting with the mode 0. It must be 0 if x is not
+     *            periodic and at most Nx/2+1 otherwise, else a std::invalid_argument is thrown.
+     */
+    ReducedDiagnostics(
+            IDomainSpXVx const& dom,
+            int nbstep_scalars,
+            int nbstep_profiles,
+            int nb_modes);
+
+    ~ReducedDiagnostics() = default;
+
+    /**
+     * @brief Get the index of each Fourier mode whose amplitude is computed, which is the
+     * coordinate of the amplitudes in the outputs.
+     * @return The index of each mode.
+     */
+    ddc::ChunkSpan<int const, ddc::DiscreteDomain<IDimMode>> modes() const
+    {
+        return m_modes.span_cview();
+    }
+
+    /**
+     * @brief Compute the diagnostics which are due at this iteration and give them to PDI.
+     * @param[in] iter The iteration index.
+     * @param[in] time_saved The time of the iteration.
+     * @param[in] allfdistribu The distribution function.
+     * @param[in] electrostatic_potential The electrostatic potential.
+     * @param[in] electric_field The electric field.
+     */
+    void operator()(
+            int iter,
+            double time_saved,
+            DViewSpXVx allfdistribu,
+            DViewX electrostatic_potential,
+            DViewX electric_field) const;
+
+    /**
+     * @brief Compute the scalars, which can then be read with the accessors below.
+     * @param[in] allfdistribu The distribution function.
+     * @param[in] electrostatic_potential The electrostatic potential.
+     * @param[in] electric_field The electric field.
+     */
+    void compute_scalars(
+            DViewSpXVx allfdistribu,
+            DViewX electrostatic_potential,
+            DViewX electric_field) const;
+
+    /**
+     * @brief Compute the profiles, which can then be read with the accessors below.
+     * @param[in] allfdistribu The distribution function.
+     */
+    void compute_profiles(DViewSpXVx allfdistribu) const;
+
+    /// @brief The energy of the electric field, 0.5 * int E^2 dx.
+    double field_energy() const
+    {
+        return m_field_energy;
+    }
+
+    /// @brief The kinetic energy of each species.
+    DViewSp kinetic_energy() const
+    {
+        return m_kinetic_energy.span_cview();
+    }
+
+    /// @brief The amplitude of each Fourier mode of the electrostatic potential.
+    ddc::ChunkSpan<double const, ddc::DiscreteDomain<IDimMode>> potential_modes() const
+    {
+        return m_potential_modes.span_cview();
+    }
+
+    /// @brief The particle flux of each species at the lower boundary.
+    DViewSp particle_flux_left() const
+    {
+        return m_particle_flux_left.span_cview();
+    }
+
+    /// @brief The particle flux of each species at the upper boundary.
+    DViewSp particle_flux_right() const
+    {
+        return m_particle_flux_right.span_cview();
+    }
+
+    /// @brief The energy flux of each species at the lower boundary.
+    DViewSp energy_flux_left() const
+    {
+        return m_energy_flux_left.span_cview();
+    }
+
+    /// @brief The energy flux of each species at the upper boundary.
+    DViewSp energy_flux_right() const
+    {
+        return m_energy_flux_right.span_cview();
+    }
+
+    /// @brief The density profile of each species.
+    DViewSpX density() const
+    {
+        return m_density.span_cview();
+    }
+
+    /// @brief The mean velocity profile of each species.
+    DViewSpX mean_velocity() const
+    {
+        return m_mean_velocity.span_cview();
+    }
+
+    /// @brief The temperature profile of each species.
+    DViewSpX temperature() const
+    {
+        return m_temperature.span_cview();
+    }
+
+    /// @brief The particle flux profile of each species.
+    DViewSpX particle_flux() const
+    {
+        return m_particle_flux.span_cview();
+    }
+
+    /// @brief The heat flux profile of each species.
+    DViewSpX heat_flux() const
+    {
+        return m_heat_flux.span_cview();
+    }
+};
@@ -180,6 +180,7 @@ using IndexXY = ddc::DiscreteElement<IDimX, IDimY>;
 using IndexVx = ddc::DiscreteElement<IDimVx>;
 using IndexVy = ddc::DiscreteElement<IDimVy>;
 using IndexXYVxVy = ddc::DiscreteElement<IDimX, IDimY, IDimVx, IDimVy>;
+using IndexSpXYVxVy = ddc::DiscreteElement<IDimSp, IDimX, IDimY, IDimVx, IDimVy>;
 
 // IVect definition
 using IVectSp = ddc::DiscreteVector<IDimSp>;
@@ -199,6 +200,7 @@ using IDomainXYVxVy = ddc::DiscreteDomain<IDimX, IDimY, IDimVx, IDimVy>;
 using IDomainVxVy = ddc::DiscreteDomain<IDimVx, IDimVy>;
 using IDomainSpVxVy = ddc::DiscreteDomain<IDimSp, IDimVx, IDimVy>;
 using IDomainSpXYVxVy = ddc::DiscreteDomain<IDimSp, IDimX, IDimY, IDimVx, IDimVy>;
+using IDomainSpVxVyXY = ddc::DiscreteDomain<IDimSp, IDimVx, IDimVy, IDimX, IDimY>;
 
 // Field definition
 template <class ElementType>
@@ -235,6 +237,10 @@ template <class ElementType>
 using FieldSpXYVxVy = ddc::Chunk<ElementType, IDomainSpXYVxVy>;
 using DFieldSpXYVxVy = FieldSpXYVxVy<double>;
 
+template <class ElementType>
+using FieldSpVxVyXY = ddc::Chunk<ElementType, IDomainSpVxVyXY>;
+using DFieldSpVxVyXY = FieldSpVxVyXY<double>;
+
 //  Span definition
 template <class ElementType>
 using SpanX = ddc::ChunkSpan<ElementType, IDomainX>;
@@ -268,6 +274,10 @@ template <class ElementType>
 using SpanSpXYVxVy = ddc::ChunkSpan<ElementType, IDomainSpXYVxVy>;
 using DSpanSpXYVxVy = SpanSpXYVxVy<double>;
 
+template <class ElementType>
+using SpanSpVxVyXY = ddc::ChunkSpan<ElementType, IDomainSpVxVyXY>;
+using DSpanSpVxVyXY = SpanSpVxVyXY<double>;
+
 // View definition
 template <class ElementType>
 using ViewSp = ddc::ChunkSpan<ElementType const, IDomainSp>;
@@ -297,6 +307,10 @@ template <class ElementType>
 using ViewSpXYVxVy = ddc::ChunkSpan<ElementType const, IDomainSpXYVxVy>;
 using DViewSpXYVxVy = ViewSpXYVxVy<double>;
 
+template <class ElementType>
+using ViewSpVxVyXY = ddc::ChunkSpan<ElementType const, IDomainSpVxVyXY>;
+using DViewSpVxVyXY = ViewSpVxVyXY<double>;
+
 // For Fourier
 using RDimFx = ddc::Fourier<RDimX>;
 using RDimFy = ddc::Fourier<RDimY>;
@@ -334,3 +348,25 @@ public:
 
     using FdistribuDDom = IDomainSpXYVxVy;
 };
+
+/**
+ * @brief The geometry of the distribution function stored with the spatial dimensions
+ * innermost.
+ *
+ * This layout is used to advect along the spatial dimensions, the lines along x and y
+ * being much closer to contiguous than in the natural layout.
+ */
+class GeometryVxVyXY
+{
+public:
+    template <class T>
+    using velocity_dim_for = GeometryXYVxVy::velocity_dim_for<T>;
+
+    using DDimSp = IDimSp;
+
+    using SpatialDDom = IDomainXY;
+
+    using VelocityDDom = IDomainVxVy;
+
+    using FdistribuDDom = IDomainSpVxVyXY;
+};
@@ -5,22 +5,26 @@
 #include <ddc/ddc.hpp>
 
 #include <geometry.hpp>
-
+#include <quadrature.hpp>
+
+/**
+ * @brief A class which computes the charge density from the distribution function.
+ *
+ * The charge density is the integral over the velocity of the 2D spline interpolation of the
+ * distribution function. This integral is a linear function of the values of the distribution
+ * function, so it is computed with quadrature coefficients obtained once from the spline builder.
+ */
 class ChargeDensityCalculator
 {
-    SplineVxVyBuilder const& m_spline_vxvy_builder;
-
-    SplineVxVyEvaluator m_spline_vxvy_evaluator;
-
-    int m_nbc_Vx;
-    int m_nbc_Vy;
-    int m_interp_dom_size_Vx;
-    int m_interp_dom_size_Vy;
+    Quadrature<IDimVx, IDimVy> m_quadrature;
 
 public:
-    ChargeDensityCalculator(
-            SplineVxVyBuilder const& spline_vxvy_builder,
-            SplineVxVyEvaluator const& spline_vxvy_evaluator);
+    /**
+     * @brief Create a ChargeDensityCalculator.
+     * @param[in] spline_vxvy_builder The builder used to interpolate the distribution function
+     *                                along (vx, vy).
+     */
+    explicit ChargeDensityCalculator(SplineVxVyBuilder const& spline_vxvy_builder);
 
     void operator()(DSpanXY rho, DViewSpXYVxVy allfdistribu) const;
 };
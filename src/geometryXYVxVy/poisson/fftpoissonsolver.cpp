@@ -2,16 +2,14 @@
 
 #include <cassert>
 #include <cmath>
-#include <complex>
-#include <iostream>
+#include <cstddef>
 
 #include <ddc/ddc.hpp>
 
-#include <sll/bsplines_uniform.hpp>
-#include <sll/null_boundary_value.hpp>
 #include <sll/spline_builder.hpp>
 #include <sll/spline_evaluator.hpp>
 
+#include <ddc_helper.hpp>
 #include <geometry.hpp>
 
 #include "fftpoissonsolver.hpp"
@@ -20,14 +18,80 @@ FftPoissonSolver::FftPoissonSolver(
         SplineXYBuilder const& spline_xy_builder,
         SplineXYEvaluator const& spline_xy_evaluator,
         SplineVxVyBuilder const& spline_vxvy_builder,
-        SplineVxVyEvaluator const& spline_vxvy_evaluator)
-    : m_compute_rho(spline_vxvy_builder, spline_vxvy_evaluator)
+        bool const spectral_electric_field,
+        std::string const& wisdom_file)
+    : m_compute_rho(spline_vxvy_builder)
     , m_electric_field(spline_xy_builder, spline_xy_evaluator)
+    , m_xy_dom(spline_xy_builder.interpolation_domain())
+    , m_spectral_electric_field(spectral_electric_field)
+    , m_field(nullptr)
+    , m_field_hat(nullptr)
+    , m_field_plan(nullptr)
 {
+    IDomainX const x_dom = ddc::select<IDimX>(m_xy_dom);
+    IDomainY const y_dom = ddc::select<IDimY>(m_xy_dom);
+    int const nx = x_dom.size();
+    int const ny = y_dom.size();
+    // The last dimension is the contiguous one, it holds the non-negative modes only
+    int const nky = ny / 2 + 1;
+    m_rho = fftw_alloc_real(nx * ny);
+    m_rho_hat = fftw_alloc_complex(nx * nky);
+
+    // Solve Poisson's equation -d2Phi/dx2 - d2Phi/dy2 = rho
+    //   in Fourier space as (kx*kx+ky*ky)*FFT(Phi)=FFT(rho)
+    // the factor 1/N normalises the backward transform
+    double const dkx = 2. * M_PI / ddcHelper::total_interval_length(x_dom);
+    double const dky = 2. * M_PI / ddcHelper::total_interval_length(y_dom);
+    m_inv_k2.resize(nx * nky);
+    for (int ikx = 0; ikx < nx; ++ikx) {
+        // the modes above nx/2 are the negative ones
+        double const kx = (ikx <= nx / 2 ? ikx : ikx - nx) * dkx;
+        for (int iky = 0; iky < nky; ++iky) {
+            double const ky = iky * dky;
+            double const k2 = kx * kx + ky * ky;
+            m_inv_k2[ikx * nky + iky] = (ikx == 0 && iky == 0) ? 0. : 1. / (k2 * nx * ny);
+        }
+    }
+
+    // The derivative of the Nyquist mode of an even number of points is not defined
+    m_kx.resize(nx);
+    for (int ikx = 0; ikx < nx; ++ikx) {
+        m_kx[ikx] = (2 * ikx == nx) ? 0. : (ikx <= nx / 2 ? ikx : ikx - nx) * dkx;
+    }
+    m_ky.resize(nky);
+    for (int iky = 0; iky < nky; ++iky) {
+        m_ky[iky] = (2 * iky == ny) ? 0. : iky * dky;
+    }
+
+    // FFTW_MEASURE overwrites the buffers, which are only filled by the solves
+    if (!wisdom_file.empty()) {
+        fftw_import_wisdom_from_filename(wisdom_file.c_str());
+    }
+    m_forward_plan = fftw_plan_dft_r2c_2d(nx, ny, m_rho, m_rho_hat, FFTW_MEASURE);
+    m_backward_plan = fftw_plan_dft_c2r_2d(nx, ny, m_rho_hat, m_rho, FFTW_MEASURE);
+    if (m_spectral_electric_field) {
+        m_field = fftw_alloc_real(nx * ny);
+        m_field_hat = fftw_alloc_complex(nx * nky);
+        m_field_plan = fftw_plan_dft_c2r_2d(nx, ny, m_field_hat, m_field, FFTW_MEASURE);
+    }
+    if (!wisdom_file.empty()) {
+        fftw_export_wisdom_to_filename(wisdom_file.c_str());
+    }
+}
+
+FftPoissonSolver::~FftPoissonSolver()
+{
+    if (m_field_plan) {
+        fftw_destroy_plan(m_field_plan);
+    }
+    fftw_free(m_field_hat);
+    fftw_free(m_field);
+    fftw_destroy_plan(m_backward_plan);
+    fftw_destroy_plan(m_forward_plan);
+    fftw_free(m_rho_hat);
+    fftw_free(m_rho);
 }
 
-// 1- Inner solvers shall be passed in the constructor
-// 2- Should it take an array of distribution functions ?
 void FftPoissonSolver::operator()(
         DSpanXY const electrostatic_potential,
         DSpanXY const electric_field_x,
@@ -35,48 +99,45 @@ void FftPoissonSolver::operator()(
         DViewSpXYVxVy const allfdistribu) const
 {
     assert((electrostatic_potential.domain() == ddc::get_domain<IDimX, IDimY>(allfdistribu)));
-    IDomainXY const xy_dom = electrostatic_potential.domain();
+    assert(electrostatic_potential.domain() == m_xy_dom);
 
     // Compute the RHS of the Poisson equation.
-    ddc::Chunk<double, IDomainXY> rho(xy_dom);
-    DFieldVxVy contiguous_slice_vxvy(allfdistribu.domain<IDimVx, IDimVy>());
+    DSpanXY const rho(m_rho, m_xy_dom);
     m_compute_rho(rho, allfdistribu);
 
-    // Build a mesh in the fourier space, for N points
-    IDomainFxFy const k_mesh = ddc::FourierMesh(xy_dom, false);
-
-    ddc::Chunk<Kokkos::complex<double>, IDomainFxFy> intermediate_chunk
-            = ddc::Chunk(k_mesh, ddc::HostAllocator<Kokkos::complex<double>>());
-
-    // Compute FFT(rho)
-    ddc::FFT_Normalization norm = ddc::FFT_Normalization::BACKWARD;
-    ddc::
-            fft(Kokkos::DefaultHostExecutionSpace(),
-                intermediate_chunk.span_view(),
-                rho.span_view(),
-                (ddc::kwArgs_fft) {.normalization = norm});
-
-    // Solve Poisson's equation -d2Phi/dx2 = rho
-    //   in Fourier space as -kx*kx*FFT(Phi)=FFT(rho))
-    intermediate_chunk(k_mesh.front()) = 0.;
-    ddc::for_each(k_mesh, [&](IndexFxFy const ikxky) {
-        IndexFx const ikx = ddc::select<IDimFx>(ikxky);
-        IndexFy const iky = ddc::select<IDimFy>(ikxky);
-
-        if (ikxky != k_mesh.front()) {
-            intermediate_chunk(ikxky) = intermediate_chunk(ikxky)
-                                        / ((double)coordinate(ikx) * (double)coordinate(ikx)
-                                           + (double)coordinate(iky) * (double)coordinate(iky));
+    // Compute FFT(rho), divide by N*(kx*kx+ky*ky) and transform back to get Phi
+    fftw_execute(m_forward_plan);
+    for (std::size_t ik = 0; ik < m_inv_k2.size(); ++ik) {
+        m_rho_hat[ik][0] *= m_inv_k2[ik];
+        m_rho_hat[ik][1] *= m_inv_k2[ik];
+    }
+
+    // Compute efield = -grad(Phi) as the inverse FFTs of -i*kx*FFT(Phi) and -i*ky*FFT(Phi)
+    // before the backward transform of Phi, which overwrites its Fourier coefficients
+    if (m_spectral_electric_field) {
+        std::size_t const nky = m_ky.size();
+        DSpanXY const field(m_field, m_xy_dom);
+        for (std::size_t ik = 0; ik < m_inv_k2.size(); ++ik) {
+            double const kx = m_kx[ik / nky];
+            m_field_hat[ik][0] = kx * m_rho_hat[ik][1];
+            m_field_hat[ik][1] = -kx * m_rho_hat[ik][0];
+        }
+        fftw_execute(m_field_plan);
+        ddc::deepcopy(electric_field_x, field);
+        for (std::size_t ik = 0; ik < m_inv_k2.size(); ++ik) {
+            double const ky = m_ky[ik % nky];
+            m_field_hat[ik][0] = ky * m_rho_hat[ik][1];
+            m_field_hat[ik][1] = -ky * m_rho_hat[ik][0];
         }
-    });
+        fftw_execute(m_field_plan);
+        ddc::deepcopy(electric_field_y, field);
+    }
 
-    // Perform the inverse 1D FFT of the solution to deduce the electrostatic potential
-    ddc::
-            ifft(Kokkos::DefaultHostExecutionSpace(),
-                 electrostatic_potential.span_view(),
-                 intermediate_chunk.span_view(),
-                 (ddc::kwArgs_fft) {.normalization = norm});
+    fftw_execute(m_backward_plan);
+    ddc::deepcopy(electrostatic_potential, rho);
 
     // Compute efield = -dPhi/dx where Phi is the electrostatic potential
-    m_electric_field(electric_field_x, electric_field_y, electrostatic_potential);
+    if (!m_spectral_electric_field) {
+        m_electric_field(electric_field_x, electric_field_y, electrostatic_potential);
+    }
 }
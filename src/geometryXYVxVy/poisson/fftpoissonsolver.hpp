@@ -2,6 +2,11 @@
 
 #pragma once
 
+#include <string>
+#include <vector>
+
+#include <fftw3.h>
+
 #include <sll/spline_builder.hpp>
 #include <sll/spline_evaluator.hpp>
 
@@ -9,20 +14,80 @@
 #include "electricfield.hpp"
 #include "ipoissonsolver.hpp"
 
+/**
+ * @brief A Poisson solver for a doubly periodic spatial domain using a Fourier transform.
+ *
+ * The FFTW plans, the buffers holding the charge density and its Fourier coefficients, and the
+ * factors 1/(N (kx^2 + ky^2)) mapping the Fourier coefficients of the charge density to those
+ * of the electrostatic potential are created once for the spatial mesh of the spline builder.
+ *
+ * The electric field is either computed by differentiating a spline interpolation of the
+ * electrostatic potential, or spectrally as the inverse transforms of -i kx FFT(Phi) and
+ * -i ky FFT(Phi), which cost two more inverse transforms but no spline solve.
+ */
 class FftPoissonSolver : public IPoissonSolver
 {
     ChargeDensityCalculator m_compute_rho;
 
     ElectricField m_electric_field;
 
+    IDomainXY m_xy_dom;
+
+    // The charge density, then the electrostatic potential, aligned by FFTW
+    double* m_rho;
+
+    // The Fourier coefficients of all the modes in x and of the non-negative modes in y
+    fftw_complex* m_rho_hat;
+
+    // The factor 1/(N (kx^2 + ky^2)) of each mode, 0 for the mode (0, 0)
+    std::vector<double> m_inv_k2;
+
+    fftw_plan m_forward_plan;
+
+    fftw_plan m_backward_plan;
+
+    bool m_spectral_electric_field;
+
+    // The wave numbers of the modes, 0 for the Nyquist modes which have no derivative
+    std::vector<double> m_kx;
+
+    std::vector<double> m_ky;
+
+    // A component of the electric field and its Fourier coefficients, only used by the
+    // spectral method
+    double* m_field;
+
+    fftw_complex* m_field_hat;
+
+    fftw_plan m_field_plan;
+
 public:
+    /**
+     * @brief Create the solver and plan the transforms of its spatial mesh.
+     * @param[in] spline_xy_builder A spline builder on the spatial mesh.
+     * @param[in] spline_xy_evaluator A spline evaluator on the spatial mesh.
+     * @param[in] spline_vxvy_builder A spline builder on the velocity mesh.
+     * @param[in] spectral_electric_field If true the electric field is computed in Fourier
+     *            space, otherwise it is the gradient of a spline of the potential.
+     * @param[in] wisdom_file A file of FFTW wisdom which is loaded before planning and
+     *            updated with the new plans, no file is used if it is empty.
+     */
     FftPoissonSolver(
             SplineXYBuilder const& spline_xy_builder,
-            SplineXYEvaluator const& spline_x_evaluator,
+            SplineXYEvaluator const& spline_xy_evaluator,
             SplineVxVyBuilder const& spline_vxvy_builder,
-            SplineVxVyEvaluator const& spline_vxvy_evaluator);
+            bool spectral_electric_field = false,
+            std::string const& wisdom_file = "");
+
+    FftPoissonSolver(FftPoissonSolver const& x) = delete;
+
+    FftPoissonSolver(FftPoissonSolver&& x) = delete;
+
+    ~FftPoissonSolver() override;
+
+    FftPoissonSolver& operator=(FftPoissonSolver const& x) = delete;
 
-    ~FftPoissonSolver() override = default;
+    FftPoissonSolver& operator=(FftPoissonSolver&& x) = delete;
 
     void operator()(
             DSpanXY electrostatic_potential,
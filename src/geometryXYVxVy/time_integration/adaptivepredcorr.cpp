@@ -0,0 +1,310 @@
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+#include <ddc/ddc.hpp>
+
+#include <ipoissonsolver.hpp>
+#include <ivlasovsolver.hpp>
+#include <species_info.hpp>
+
+#include "adaptivepredcorr.hpp"
+
+namespace {
+
+template <class IDim>
+double min_cell_size(ddc::DiscreteDomain<IDim> const& dom)
+{
+    double cell_size = std::numeric_limits<double>::infinity();
+    for (ddc::DiscreteElement<IDim> const i : dom.remove_last(ddc::DiscreteVector<IDim>(1))) {
+        cell_size = std::min(cell_size, double(ddc::coordinate(i + 1) - ddc::coordinate(i)));
+    }
+    return cell_size;
+}
+
+template <class IDim>
+double max_abs_coordinate(ddc::DiscreteDomain<IDim> const& dom)
+{
+    return std::max(
+            std::fabs(double(ddc::coordinate(dom.front()))),
+            std::fabs(double(ddc::coordinate(dom.back()))));
+}
+
+double max_abs(DViewXY const field)
+{
+    return ddc::transform_reduce(
+            field.domain(),
+            0.,
+            ddc::reducer::max<double>(),
+            [&](IndexXY const ixy) { return std::fabs(field(ixy)); });
+}
+
+/**
+ * The largest difference between the field at tn+1/2 and its linear extrapolation
+ * efield_b + coeff * (efield_b - efield_a) from two earlier fields.
+ */
+double extrapolation_error(
+        DViewXY const efield_half_t,
+        DViewXY const efield_a,
+        DViewXY const efield_b,
+        double const coeff)
+{
+    return ddc::transform_reduce(
+            efield_half_t.domain(),
+            0.,
+            ddc::reducer::max<double>(),
+            [&](IndexXY const ixy) {
+                double const efield_extrapolated
+                        = efield_b(ixy) + coeff * (efield_b(ixy) - efield_a(ixy));
+                return std::fabs(efield_half_t(ixy) - efield_extrapolated);
+            });
+}
+
+} // namespace
+
+AdaptivePredCorr::AdaptivePredCorr(
+        IVlasovSolver const& vlasov_solver,
+        IPoissonSolver const& poisson_solver,
+        double const dt_min,
+        double const dt_max,
+        double const tolerance,
+        double const cfl)
+    : m_vlasov_solver(vlasov_solver)
+    , m_poisson_solver(poisson_solver)
+    , m_dt_min(dt_min)
+    , m_dt_max(dt_max)
+    , m_tolerance(tolerance)
+    , m_cfl(cfl)
+    , m_history_time(std::numeric_limits<double>::quiet_NaN())
+    , m_dt_prev(0.)
+    , m_dt_next(0.)
+{
+    if (m_dt_min <= 0. || m_dt_max < m_dt_min) {
+        throw std::invalid_argument("The time step bounds should verify 0 < dt_min <= dt_max.");
+    }
+}
+
+void AdaptivePredCorr::set_history(
+        double const time,
+        double const dt_prev,
+        double const dt_next,
+        DViewXY const electric_field_x_prev,
+        DViewXY const electric_field_y_prev) const
+{
+    IDomainXY const gridxy = electric_field_x_prev.domain();
+    m_history_time = time;
+    m_dt_prev = dt_prev;
+    m_dt_next = dt_next;
+    m_electric_field_x_prev.resize(gridxy.size());
+    m_electric_field_y_prev.resize(gridxy.size());
+    ddc::deepcopy(DSpanXY(m_electric_field_x_prev.data(), gridxy), electric_field_x_prev);
+    ddc::deepcopy(DSpanXY(m_electric_field_y_prev.data(), gridxy), electric_field_y_prev);
+}
+
+DSpanSpXYVxVy AdaptivePredCorr::operator()(
+        DSpanSpXYVxVy const allfdistribu,
+        double const dt,
+        int const steps,
+        int const iter_start) const
+{
+    IDomainXY const gridxy = allfdistribu.domain<IDimX, IDimY>();
+
+    // electrostatic potential and electric field (depending only on x and y)
+    DFieldXY electrostatic_potential(gridxy);
+    DFieldXY electric_field_x(gridxy);
+    DFieldXY electric_field_y(gridxy);
+    DFieldXY electric_field_x_prev(gridxy);
+    DFieldXY electric_field_y_prev(gridxy);
+    DFieldXY electric_field_x_quarter_t(gridxy);
+    DFieldXY electric_field_y_quarter_t(gridxy);
+    DFieldXY electric_field_x_half_t(gridxy);
+    DFieldXY electric_field_y_half_t(gridxy);
+
+    // a 2D chunck of the same size as fdistribu
+    DFieldSpXYVxVy allfdistribu_half_t(allfdistribu.domain());
+
+    // the largest velocities and the largest acceleration per unit of electric field
+    double const max_vx = max_abs_coordinate(allfdistribu.domain<IDimVx>());
+    double const max_vy = max_abs_coordinate(allfdistribu.domain<IDimVy>());
+    double max_sqrt_me_on_mspecies = 0.;
+    double max_charge_ratio = 0.;
+    for (IndexSp const isp : allfdistribu.domain<IDimSp>()) {
+        double const sqrt_me_on_mspecies = std::sqrt(mass(ielec()) / mass(isp));
+        max_sqrt_me_on_mspecies = std::max(max_sqrt_me_on_mspecies, sqrt_me_on_mspecies);
+        max_charge_ratio = std::max(max_charge_ratio, std::fabs(charge(isp)) * sqrt_me_on_mspecies);
+    }
+    double const dt_cfl_space = m_cfl / max_sqrt_me_on_mspecies
+                                * std::min(
+                                        min_cell_size(allfdistribu.domain<IDimX>()) / max_vx,
+                                        min_cell_size(allfdistribu.domain<IDimY>()) / max_vy);
+    double const dvx_min = min_cell_size(allfdistribu.domain<IDimVx>());
+    double const dvy_min = min_cell_size(allfdistribu.domain<IDimVy>());
+
+    // continue from the history of the previous call if it stopped where this one starts
+    double dt_next = std::min(dt, m_dt_max);
+    double dt_prev = 0.;
+    if (iter_start * dt == m_history_time && m_electric_field_x_prev.size() == gridxy.size()) {
+        dt_next = m_dt_next;
+        dt_prev = m_dt_prev;
+        ddc::deepcopy(electric_field_x_prev, DViewXY(m_electric_field_x_prev.data(), gridxy));
+        ddc::deepcopy(electric_field_y_prev, DViewXY(m_electric_field_y_prev.data(), gridxy));
+    } else {
+        ddc::fill(electric_field_x_prev, 0.);
+        ddc::fill(electric_field_y_prev, 0.);
+    }
+
+    m_poisson_solver(electrostatic_potential, electric_field_x, electric_field_y, allfdistribu);
+
+    int iter = iter_start;
+    for (; iter < iter_start + steps; ++iter) {
+        double const iter_time = iter * dt;
+
+        ddc::PdiEvent("iteration")
+                .with("iter", iter)
+                .and_with("time_saved", iter_time)
+                .and_with("fdistribu", allfdistribu)
+                .and_with("electrostatic_potential", electrostatic_potential)
+                .and_with("electric_field_x_prev", electric_field_x_prev)
+                .and_with("electric_field_y_prev", electric_field_y_prev)
+                .and_with("dt_prev", dt_prev)
+                .and_with("dt_next", dt_next);
+
+        double time_left = dt;
+        while (time_left > 1.e-12 * dt) {
+            double const max_efield_x = max_abs(electric_field_x);
+            double const max_efield_y = max_abs(electric_field_y);
+            double const max_efield = std::max(max_efield_x, max_efield_y);
+
+            // limit the displacements of the advections
+            double dt_cfl = dt_cfl_space;
+            if (max_efield_x * max_charge_ratio > 0.) {
+                dt_cfl = std::min(dt_cfl, m_cfl * dvx_min / (max_efield_x * max_charge_ratio));
+            }
+            if (max_efield_y * max_charge_ratio > 0.) {
+                dt_cfl = std::min(dt_cfl, m_cfl * dvy_min / (max_efield_y * max_charge_ratio));
+            }
+            // the proposed step, which is only cut to reach the next output
+            double dt_step = std::min(dt_next, dt_cfl);
+            double dt_sub = std::min(dt_step, time_left);
+
+            double factor = 2.;
+            bool accepted = false;
+            while (!accepted) {
+                // without history the field at tn+1/2 is extrapolated from the fields at tn
+                // and at tn+1/4 given by a shorter predictor
+                if (dt_prev == 0.) {
+                    ddc::deepcopy(allfdistribu_half_t, allfdistribu);
+                    m_vlasov_solver(
+                            allfdistribu_half_t,
+                            electric_field_x,
+                            electric_field_y,
+                            dt_sub / 4);
+                    m_poisson_solver(
+                            electrostatic_potential,
+                            electric_field_x_quarter_t,
+                            electric_field_y_quarter_t,
+                            allfdistribu_half_t);
+                }
+
+                // predictor
+                ddc::deepcopy(allfdistribu_half_t, allfdistribu);
+                m_vlasov_solver(
+                        allfdistribu_half_t,
+                        electric_field_x,
+                        electric_field_y,
+                        dt_sub / 2);
+                m_poisson_solver(
+                        electrostatic_potential,
+                        electric_field_x_half_t,
+                        electric_field_y_half_t,
+                        allfdistribu_half_t);
+
+                // local error estimate from the extrapolation of the field at tn+1/2
+                double error = 0.;
+                if (dt_prev > 0.) {
+                    double const extrapolation_coeff = dt_sub / (2. * dt_prev);
+                    error = std::max(
+                            extrapolation_error(
+                                    electric_field_x_half_t,
+                                    electric_field_x_prev,
+                                    electric_field_x,
+                                    extrapolation_coeff),
+                            extrapolation_error(
+                                    electric_field_y_half_t,
+                                    electric_field_y_prev,
+                                    electric_field_y,
+                                    extrapolation_coeff));
+                } else {
+                    error = std::max(
+                            extrapolation_error(
+                                    electric_field_x_half_t,
+                                    electric_field_x,
+                                    electric_field_x_quarter_t,
+                                    1.),
+                            extrapolation_error(
+                                    electric_field_y_half_t,
+                                    electric_field_y,
+                                    electric_field_y_quarter_t,
+                                    1.));
+                }
+                error /= m_tolerance * (1. + max_efield);
+                factor = 2.;
+                if (error > 0.) {
+                    // the error is of second order in dt
+                    factor = std::clamp(0.9 / std::sqrt(error), 0.2, 2.);
+                }
+                accepted = error <= 1.;
+
+                if (!accepted) {
+                    if (dt_sub <= m_dt_min) {
+                        throw std::runtime_error(
+                                "The local error of the adaptive time step is above the "
+                                "tolerance with the smallest allowed time step.");
+                    }
+                    dt_step = std::max(factor * dt_sub, m_dt_min);
+                    dt_sub = std::min(dt_step, time_left);
+                }
+            }
+            bool const cut = dt_sub < dt_step;
+
+            // correction on dt_sub
+            m_vlasov_solver(allfdistribu, electric_field_x_half_t, electric_field_y_half_t, dt_sub);
+
+            if (cut) {
+                // the error of a cut step does not tell how the proposed step would behave, and
+                // the field before the cut remains a better conditioned point of extrapolation
+                dt_next = dt_step;
+                if (dt_prev > 0.) {
+                    dt_prev += dt_sub;
+                }
+            } else {
+                dt_next = std::clamp(factor * dt_sub, m_dt_min, m_dt_max);
+                ddc::deepcopy(electric_field_x_prev, electric_field_x);
+                ddc::deepcopy(electric_field_y_prev, electric_field_y);
+                dt_prev = dt_sub;
+            }
+            time_left -= dt_sub;
+
+            // computation of the electrostatic potential at the end of the sub-step
+            m_poisson_solver(
+                    electrostatic_potential,
+                    electric_field_x,
+                    electric_field_y,
+                    allfdistribu);
+        }
+    }
+
+    double const final_time = iter * dt;
+    set_history(final_time, dt_prev, dt_next, electric_field_x_prev, electric_field_y_prev);
+
+    ddc::PdiEvent("last_iteration")
+            .with("iter", iter)
+            .and_with("time_saved", final_time)
+            .and_with("fdistribu", allfdistribu)
+            .and_with("electrostatic_potential", electrostatic_potential);
+
+    return allfdistribu;
+}
@@ -0,0 +1,111 @@
+// SPDX-License-Identifier: MIT
+
+#include <ddc/ddc.hpp>
+
+#include <ipoissonsolver.hpp>
+#include <ivlasovsolver.hpp>
+
+#include "extrapolatedpredcorr.hpp"
+
+ExtrapolatedPredCorr::ExtrapolatedPredCorr(
+        IVlasovSolver const& vlasov_solver,
+        IPoissonSolver const& poisson_solver)
+    : m_vlasov_solver(vlasov_solver)
+    , m_poisson_solver(poisson_solver)
+    , m_history_iter(-1)
+    , m_history_dt(0.)
+{
+}
+
+void ExtrapolatedPredCorr::set_history(
+        int const iter,
+        double const dt,
+        DViewXY const electric_field_x_prev,
+        DViewXY const electric_field_y_prev) const
+{
+    IDomainXY const gridxy = electric_field_x_prev.domain();
+    m_history_iter = iter;
+    m_history_dt = dt;
+    m_electric_field_x_prev.resize(gridxy.size());
+    m_electric_field_y_prev.resize(gridxy.size());
+    ddc::deepcopy(DSpanXY(m_electric_field_x_prev.data(), gridxy), electric_field_x_prev);
+    ddc::deepcopy(DSpanXY(m_electric_field_y_prev.data(), gridxy), electric_field_y_prev);
+}
+
+DSpanSpXYVxVy ExtrapolatedPredCorr::operator()(
+        DSpanSpXYVxVy const allfdistribu,
+        double const dt,
+        int const steps,
+        int const iter_start) const
+{
+    // electrostatic potential and electric field (depending only on x and y)
+    DFieldXY electrostatic_potential(allfdistribu.domain<IDimX, IDimY>());
+    DFieldXY electric_field_x(allfdistribu.domain<IDimX, IDimY>());
+    DFieldXY electric_field_y(allfdistribu.domain<IDimX, IDimY>());
+    DFieldXY electric_field_x_prev(allfdistribu.domain<IDimX, IDimY>());
+    DFieldXY electric_field_y_prev(allfdistribu.domain<IDimX, IDimY>());
+    DFieldXY electric_field_x_half_t(allfdistribu.domain<IDimX, IDimY>());
+    DFieldXY electric_field_y_half_t(allfdistribu.domain<IDimX, IDimY>());
+
+    // continue from the history of the previous call if it stopped where this one starts
+    IDomainXY const gridxy = allfdistribu.domain<IDimX, IDimY>();
+    bool const history = iter_start == m_history_iter && dt == m_history_dt
+                         && m_electric_field_x_prev.size() == gridxy.size();
+    if (history) {
+        ddc::deepcopy(electric_field_x_prev, DViewXY(m_electric_field_x_prev.data(), gridxy));
+        ddc::deepcopy(electric_field_y_prev, DViewXY(m_electric_field_y_prev.data(), gridxy));
+    }
+
+    int iter = iter_start;
+    for (; iter < iter_start + steps; ++iter) {
+        double const iter_time = iter * dt;
+
+        // computation of the electrostatic potential at time tn and
+        // the associated electric field
+        m_poisson_solver(electrostatic_potential, electric_field_x, electric_field_y, allfdistribu);
+        if (iter == iter_start && !history) {
+            ddc::deepcopy(electric_field_x_prev, electric_field_x);
+            ddc::deepcopy(electric_field_y_prev, electric_field_y);
+        }
+
+        ddc::PdiEvent("iteration")
+                .with("iter", iter)
+                .and_with("time_saved", iter_time)
+                .and_with("fdistribu", allfdistribu)
+                .and_with("electrostatic_potential", electrostatic_potential)
+                .and_with("electric_field_x_prev", electric_field_x_prev)
+                .and_with("electric_field_y_prev", electric_field_y_prev);
+
+        // predictor: extrapolation of the electric field at time tn+1/2
+        if (iter == iter_start && !history) {
+            ddc::deepcopy(electric_field_x_half_t, electric_field_x);
+            ddc::deepcopy(electric_field_y_half_t, electric_field_y);
+        } else {
+            ddc::for_each(electric_field_x.domain(), [&](IndexXY const ixy) {
+                electric_field_x_half_t(ixy)
+                        = 1.5 * electric_field_x(ixy) - 0.5 * electric_field_x_prev(ixy);
+                electric_field_y_half_t(ixy)
+                        = 1.5 * electric_field_y(ixy) - 0.5 * electric_field_y_prev(ixy);
+            });
+        }
+        ddc::deepcopy(electric_field_x_prev, electric_field_x);
+        ddc::deepcopy(electric_field_y_prev, electric_field_y);
+
+        // correction on a dt
+        m_vlasov_solver(allfdistribu, electric_field_x_half_t, electric_field_y_half_t, dt);
+    }
+
+    if (steps > 0) {
+        set_history(iter, dt, electric_field_x_prev, electric_field_y_prev);
+    }
+
+    double const final_time = iter * dt;
+    m_poisson_solver(electrostatic_potential, electric_field_x, electric_field_y, allfdistribu);
+    ddc::PdiEvent("last_iteration")
+            .with("iter", iter)
+            .and_with("time_saved", final_time)
+            .and_with("fdistribu", allfdistribu)
+            .and_with("electrostatic_potential", electrostatic_potential);
+
+    return allfdistribu;
+}
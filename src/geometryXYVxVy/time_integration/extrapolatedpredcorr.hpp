@@ -0,0 +1,70 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <vector>
+
+#include <geometry.hpp>
+
+#include "itimesolver.hpp"
+
+class IPoissonSolver;
+class IVlasovSolver;
+
+/**
+ * @brief A predictor-corrector time solver whose predictor only acts on the electric field.
+ *
+ * The electric field at time t^{n+1/2} is extrapolated from the fields at times t^n and
+ * t^{n-1}: E^{n+1/2} = (3 E^n - E^{n-1}) / 2, which is second order accurate like the
+ * predictor of PredCorr. The distribution function is therefore neither copied nor advected
+ * twice. The field at t^{-1} is not known so the first iteration uses E^0.
+ *
+ * The field at t^{n-1} is exposed as "electric_field_x_prev" and "electric_field_y_prev" with
+ * the "iteration" event of t^n so that it can be written with the checkpoints. It is kept
+ * between two calls when the second one starts where the first one stopped, and set_history()
+ * gives back the field read from a checkpoint, so a run advanced in several calls or restarted
+ * from a checkpoint takes the same steps as a single run. The operator is thus not reentrant.
+ */
+class ExtrapolatedPredCorr : public ITimeSolver
+{
+private:
+    IVlasovSolver const& m_vlasov_solver;
+
+    IPoissonSolver const& m_poisson_solver;
+
+    // The field at the iteration preceding m_history_iter, valid for a call starting at
+    // m_history_iter with the time step m_history_dt on a mesh of the same size
+    mutable int m_history_iter;
+
+    mutable double m_history_dt;
+
+    mutable std::vector<double> m_electric_field_x_prev;
+
+    mutable std::vector<double> m_electric_field_y_prev;
+
+public:
+    ExtrapolatedPredCorr(
+            IVlasovSolver const& vlasov_solver,
+            IPoissonSolver const& poisson_solver);
+
+    ~ExtrapolatedPredCorr() override = default;
+
+    /**
+     * @brief Set the electric field of the iteration preceding a checkpoint.
+     * @param[in] iter The iteration of the checkpoint.
+     * @param[in] dt The time step of the run which wrote the checkpoint.
+     * @param[in] electric_field_x_prev The field along x saved as "electric_field_x_prev".
+     * @param[in] electric_field_y_prev The field along y saved as "electric_field_y_prev".
+     */
+    void set_history(
+            int iter,
+            double dt,
+            DViewXY electric_field_x_prev,
+            DViewXY electric_field_y_prev) const;
+
+    DSpanSpXYVxVy operator()(
+            DSpanSpXYVxVy allfdistribu,
+            double dt,
+            int steps = 1,
+            int iter_start = 0) const override;
+};
@@ -13,13 +13,25 @@
 PredCorr::PredCorr(IVlasovSolver const& vlasov_solver, IPoissonSolver const& poisson_solver)
     : m_vlasov_solver(vlasov_solver)
     , m_poisson_solver(poisson_solver)
+    , m_output(nullptr)
+{
+}
+
+PredCorr::PredCorr(
+        IVlasovSolver const& vlasov_solver,
+        IPoissonSolver const& poisson_solver,
+        AsyncPdiWriter<IDomainSpXYVxVy, IDomainXY>& output)
+    : m_vlasov_solver(vlasov_solver)
+    , m_poisson_solver(poisson_solver)
+    , m_output(&output)
 {
 }
 
 DSpanSpXYVxVy PredCorr::operator()(
         DSpanSpXYVxVy const allfdistribu,
         double const dt,
-        int const steps) const
+        int const steps,
+        int const iter_start) const
 {
     // electrostatic potential and electric field (depending only on x)
     DFieldXY electrostatic_potential(allfdistribu.domain<IDimX, IDimY>());
@@ -31,19 +43,15 @@ DSpanSpXYVxVy PredCorr::operator()(
 
     m_poisson_solver(electrostatic_potential, electric_field_x, electric_field_y, allfdistribu);
 
-    int iter = 0;
-    for (; iter < steps; ++iter) {
+    int iter = iter_start;
+    for (; iter < iter_start + steps; ++iter) {
         double const iter_time = iter * dt;
 
         // computation of the electrostatic potential at time tn and
         // the associated electric field
         m_poisson_solver(electrostatic_potential, electric_field_x, electric_field_y, allfdistribu);
 
-        ddc::PdiEvent("iteration")
-                .with("iter", iter)
-                .and_with("time_saved", iter_time)
-                .and_with("fdistribu", allfdistribu)
-                .and_with("electrostatic_potential", electrostatic_potential);
+        output("iteration", iter, iter_time, allfdistribu, electrostatic_potential);
 
         // copy fdistribu
         ddc::deepcopy(allfdistribu_half_t, allfdistribu);
@@ -65,11 +73,25 @@ DSpanSpXYVxVy PredCorr::operator()(
 
     double const final_time = iter * dt;
     m_poisson_solver(electrostatic_potential, electric_field_x, electric_field_y, allfdistribu);
-    ddc::PdiEvent("last_iteration")
-            .with("iter", iter)
-            .and_with("time_saved", final_time)
-            .and_with("fdistribu", allfdistribu)
-            .and_with("electrostatic_potential", electrostatic_potential);
+    output("last_iteration", iter, final_time, allfdistribu, electrostatic_potential);
 
     return allfdistribu;
 }
+
+void PredCorr::output(
+        std::string const& event,
+        int const iter,
+        double const time_saved,
+        DSpanSpXYVxVy const allfdistribu,
+        DSpanXY const electrostatic_potential) const
+{
+    if (m_output) {
+        (*m_output)(event, iter, time_saved, allfdistribu, electrostatic_potential);
+    } else {
+        ddc::PdiEvent(event)
+                .with("iter", iter)
+                .and_with("time_saved", time_saved)
+                .and_with("fdistribu", allfdistribu)
+                .and_with("electrostatic_potential", electrostatic_potential);
+    }
+}
@@ -2,6 +2,9 @@
 
 #pragma once
 
+#include <string>
+
+#include <async_pdi_writer.hpp>
 #include <geometry.hpp>
 
 #include "itimesolver.hpp"
@@ -16,10 +19,35 @@ private:
 
     IPoissonSolver const& m_poisson_solver;
 
+    AsyncPdiWriter<IDomainSpXYVxVy, IDomainXY>* m_output;
+
 public:
     PredCorr(IVlasovSolver const& vlasov_solver, IPoissonSolver const& poisson_solver);
 
+    /**
+     * @brief Create a predictor-corrector whose outputs are written asynchronously.
+     * @param[in] vlasov_solver The solver advancing the distribution function.
+     * @param[in] poisson_solver The solver computing the electric field.
+     * @param[in] output The writer which triggers the output events from a background thread.
+     */
+    PredCorr(
+            IVlasovSolver const& vlasov_solver,
+            IPoissonSolver const& poisson_solver,
+            AsyncPdiWriter<IDomainSpXYVxVy, IDomainXY>& output);
+
     ~PredCorr() override = default;
 
-    DSpanSpXYVxVy operator()(DSpanSpXYVxVy allfdistribu, double dt, int steps = 1) const override;
+    DSpanSpXYVxVy operator()(
+            DSpanSpXYVxVy allfdistribu,
+            double dt,
+            int steps = 1,
+            int iter_start = 0) const override;
+
+private:
+    void output(
+            std::string const& event,
+            int iter,
+            double time_saved,
+            DSpanSpXYVxVy allfdistribu,
+            DSpanXY electrostatic_potential) const;
 };
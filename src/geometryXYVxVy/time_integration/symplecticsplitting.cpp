@@ -0,0 +1,123 @@
+// SPDX-License-Identifier: MIT
+
+#include <cassert>
+#include <cmath>
+
+#include <ddc/ddc.hpp>
+
+#include <iadvectionvx.hpp>
+#include <iadvectionx.hpp>
+#include <ipoissonsolver.hpp>
+
+#include "symplecticsplitting.hpp"
+
+SymplecticSplitting::SymplecticSplitting(
+        IAdvectionSpatial<GeometryXYVxVy, IDimX> const& advec_x,
+        IAdvectionSpatial<GeometryXYVxVy, IDimY> const& advec_y,
+        IAdvectionVelocity<GeometryXYVxVy, IDimVx> const& advec_vx,
+        IAdvectionVelocity<GeometryXYVxVy, IDimVy> const& advec_vy,
+        IPoissonSolver const& poisson_solver,
+        SplittingScheme const scheme)
+    : m_advec_x(advec_x)
+    , m_advec_y(advec_y)
+    , m_advec_vx(advec_vx)
+    , m_advec_vy(advec_vy)
+    , m_poisson_solver(poisson_solver)
+    , m_output(nullptr)
+{
+    switch (scheme) {
+    case SplittingScheme::Ruth3:
+        m_coeffs_spatial = {0., -1. / 24., 3. / 4., 7. / 24.};
+        m_coeffs_velocity = {1., -2. / 3., 2. / 3., 0.};
+        break;
+    case SplittingScheme::Yoshida4: {
+        double const w1 = 1. / (2. - std::cbrt(2.));
+        double const w0 = -std::cbrt(2.) / (2. - std::cbrt(2.));
+        m_coeffs_spatial = {w1 / 2., (w0 + w1) / 2., (w0 + w1) / 2., w1 / 2.};
+        m_coeffs_velocity = {w1, w0, w1, 0.};
+        break;
+    }
+    }
+    assert(m_coeffs_spatial.size() == m_coeffs_velocity.size());
+}
+
+SymplecticSplitting::SymplecticSplitting(
+        IAdvectionSpatial<GeometryXYVxVy, IDimX> const& advec_x,
+        IAdvectionSpatial<GeometryXYVxVy, IDimY> const& advec_y,
+        IAdvectionVelocity<GeometryXYVxVy, IDimVx> const& advec_vx,
+        IAdvectionVelocity<GeometryXYVxVy, IDimVy> const& advec_vy,
+        IPoissonSolver const& poisson_solver,
+        SplittingScheme const scheme,
+        AsyncPdiWriter<IDomainSpXYVxVy, IDomainXY>& output)
+    : SymplecticSplitting(advec_x, advec_y, advec_vx, advec_vy, poisson_solver, scheme)
+{
+    m_output = &output;
+}
+
+DSpanSpXYVxVy SymplecticSplitting::operator()(
+        DSpanSpXYVxVy const allfdistribu,
+        double const dt,
+        int const steps,
+        int const iter_start) const
+{
+    // electrostatic potential and electric field (depending only on x and y)
+    DFieldXY electrostatic_potential(allfdistribu.domain<IDimX, IDimY>());
+    DFieldXY electric_field_x(allfdistribu.domain<IDimX, IDimY>());
+    DFieldXY electric_field_y(allfdistribu.domain<IDimX, IDimY>());
+
+    int iter = iter_start;
+    for (; iter < iter_start + steps; ++iter) {
+        double const iter_time = iter * dt;
+
+        // computation of the electrostatic potential at time tn
+        m_poisson_solver(electrostatic_potential, electric_field_x, electric_field_y, allfdistribu);
+
+        output("iteration", iter, iter_time, allfdistribu, electrostatic_potential);
+
+        // the electric field only changes with the spatial advections
+        bool field_up_to_date = true;
+        for (std::size_t stage = 0; stage < m_coeffs_spatial.size(); ++stage) {
+            if (m_coeffs_spatial[stage] != 0.) {
+                m_advec_x(allfdistribu, m_coeffs_spatial[stage] * dt);
+                m_advec_y(allfdistribu, m_coeffs_spatial[stage] * dt);
+                field_up_to_date = false;
+            }
+            if (m_coeffs_velocity[stage] != 0.) {
+                if (!field_up_to_date) {
+                    m_poisson_solver(
+                            electrostatic_potential,
+                            electric_field_x,
+                            electric_field_y,
+                            allfdistribu);
+                    field_up_to_date = true;
+                }
+                m_advec_vx(allfdistribu, electric_field_x, m_coeffs_velocity[stage] * dt);
+                m_advec_vy(allfdistribu, electric_field_y, m_coeffs_velocity[stage] * dt);
+            }
+        }
+    }
+
+    double const final_time = iter * dt;
+    m_poisson_solver(electrostatic_potential, electric_field_x, electric_field_y, allfdistribu);
+    output("last_iteration", iter, final_time, allfdistribu, electrostatic_potential);
+
+    return allfdistribu;
+}
+
+void SymplecticSplitting::output(
+        std::string const& event,
+        int const iter,
+        double const time_saved,
+        DSpanSpXYVxVy const allfdistribu,
+        DSpanXY const electrostatic_potential) const
+{
+    if (m_output) {
+        (*m_output)(event, iter, time_saved, allfdistribu, electrostatic_potential);
+    } else {
+        ddc::PdiEvent(event)
+                .with("iter", iter)
+                .and_with("time_saved", time_saved)
+                .and_with("fdistribu", allfdistribu)
+                .and_with("electrostatic_potential", electrostatic_potential);
+    }
+}
@@ -0,0 +1,104 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include <async_pdi_writer.hpp>
+#include <geometry.hpp>
+
+#include "itimesolver.hpp"
+
+class IPoissonSolver;
+template <class Geometry, class DDimX>
+class IAdvectionSpatial;
+template <class Geometry, class DDimV>
+class IAdvectionVelocity;
+
+/**
+ * The high order splitting schemes which can be used by SymplecticSplitting.
+ * - Ruth3: the third order scheme of Ruth with 3 stages,
+ * - Yoshida4: the fourth order scheme of Yoshida with 3 stages.
+ */
+enum class SplittingScheme { Ruth3, Yoshida4 };
+
+/**
+ * @brief A time solver composing the free streaming and the acceleration of the Vlasov-Poisson
+ * system with the coefficients of a high order symplectic splitting scheme.
+ *
+ * Each stage is made of the advections along x and y followed by the advections along vx and vy.
+ * The advections along x and y commute, and so do the advections along vx and vy when the field
+ * is frozen. The electric field is computed from the distribution function just before the
+ * velocity advections. As they do not change the density, the field is constant during these
+ * advections, so both flows are solved exactly in time and the order of the time solver is the
+ * order of the splitting.
+ *
+ * @warning The stages only call the advection operators, they do not go through an
+ * IVlasovSolver. The scheme therefore solves the collisionless Vlasov-Poisson system without
+ * any source, and it cannot be combined with the terms of another Vlasov solver.
+ */
+class SymplecticSplitting : public ITimeSolver
+{
+private:
+    IAdvectionSpatial<GeometryXYVxVy, IDimX> const& m_advec_x;
+
+    IAdvectionSpatial<GeometryXYVxVy, IDimY> const& m_advec_y;
+
+    IAdvectionVelocity<GeometryXYVxVy, IDimVx> const& m_advec_vx;
+
+    IAdvectionVelocity<GeometryXYVxVy, IDimVy> const& m_advec_vy;
+
+    IPoissonSolver const& m_poisson_solver;
+
+    // The fractions of the time step of the spatial and velocity advections of each stage
+    std::vector<double> m_coeffs_spatial;
+
+    std::vector<double> m_coeffs_velocity;
+
+    AsyncPdiWriter<IDomainSpXYVxVy, IDomainXY>* m_output;
+
+public:
+    SymplecticSplitting(
+            IAdvectionSpatial<GeometryXYVxVy, IDimX> const& advec_x,
+            IAdvectionSpatial<GeometryXYVxVy, IDimY> const& advec_y,
+            IAdvectionVelocity<GeometryXYVxVy, IDimVx> const& advec_vx,
+            IAdvectionVelocity<GeometryXYVxVy, IDimVy> const& advec_vy,
+            IPoissonSolver const& poisson_solver,
+            SplittingScheme scheme);
+
+    /**
+     * @brief Create a splitting scheme whose outputs are written asynchronously.
+     * @param[in] advec_x The advection operator along x.
+     * @param[in] advec_y The advection operator along y.
+     * @param[in] advec_vx The advection operator along vx.
+     * @param[in] advec_vy The advection operator along vy.
+     * @param[in] poisson_solver The solver computing the electric field.
+     * @param[in] scheme The coefficients of the splitting.
+     * @param[in] output The writer which triggers the output events from a background thread.
+     */
+    SymplecticSplitting(
+            IAdvectionSpatial<GeometryXYVxVy, IDimX> const& advec_x,
+            IAdvectionSpatial<GeometryXYVxVy, IDimY> const& advec_y,
+            IAdvectionVelocity<GeometryXYVxVy, IDimVx> const& advec_vx,
+            IAdvectionVelocity<GeometryXYVxVy, IDimVy> const& advec_vy,
+            IPoissonSolver const& poisson_solver,
+            SplittingScheme scheme,
+            AsyncPdiWriter<IDomainSpXYVxVy, IDomainXY>& output);
+
+    ~SymplecticSplitting() override = default;
+
+    DSpanSpXYVxVy operator()(
+            DSpanSpXYVxVy allfdistribu,
+            double dt,
+            int steps = 1,
+            int iter_start = 0) const override;
+
+private:
+    void output(
+            std::string const& event,
+            int iter,
+            double time_saved,
+            DSpanSpXYVxVy allfdistribu,
+            DSpanXY electrostatic_potential) const;
+};
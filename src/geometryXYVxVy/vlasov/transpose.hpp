@@ -0,0 +1,91 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+
+#include <ddc/ddc.hpp>
+
+#include <sll/view.hpp>
+
+#include <geometry.hpp>
+
+/**
+ * @brief Transpose a matrix out-of-place, tile by tile.
+ *
+ * The tiles are small enough for all the cache lines they touch in both matrices to stay
+ * in cache, so neither the reads nor the writes are made with a large stride.
+ *
+ * @param[out] dst The transposed matrix.
+ * @param[in] src The matrix to transpose.
+ */
+inline void transpose_blocked(DSpan2D const dst, DView2D const src)
+{
+    constexpr std::size_t tile_size = 32;
+    std::size_t const nrows = src.extent(0);
+    std::size_t const ncols = src.extent(1);
+    assert(dst.extent(0) == ncols);
+    assert(dst.extent(1) == nrows);
+    for (std::size_t i_begin = 0; i_begin < nrows; i_begin += tile_size) {
+        std::size_t const i_end = std::min(i_begin + tile_size, nrows);
+        for (std::size_t j_begin = 0; j_begin < ncols; j_begin += tile_size) {
+            std::size_t const j_end = std::min(j_begin + tile_size, ncols);
+            for (std::size_t i = i_begin; i < i_end; ++i) {
+                for (std::size_t j = j_begin; j < j_end; ++j) {
+                    dst(j, i) = src(i, j);
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Copy the distribution function from the natural layout to the layout where the
+ * spatial dimensions are innermost.
+ *
+ * @param[out] dst The distribution function with the spatial dimensions innermost.
+ * @param[in] src The distribution function in the natural layout.
+ *
+ * @return The distribution function with the spatial dimensions innermost.
+ */
+inline DSpanSpVxVyXY transpose_layout(DSpanSpVxVyXY const dst, DViewSpXYVxVy const src)
+{
+    std::size_t const nxy = ddc::select<IDimX, IDimY>(src.domain()).size();
+    std::size_t const nvxvy = ddc::select<IDimVx, IDimVy>(src.domain()).size();
+    assert(ddc::select<IDimSp>(dst.domain()) == ddc::select<IDimSp>(src.domain()));
+    assert(ddc::select<IDimX, IDimY>(dst.domain()) == ddc::select<IDimX, IDimY>(src.domain()));
+    assert(ddc::select<IDimVx, IDimVy>(dst.domain())
+           == ddc::select<IDimVx, IDimVy>(src.domain()));
+    ddc::for_each(ddc::get_domain<IDimSp>(src), [&](IndexSp const isp) {
+        transpose_blocked(
+                DSpan2D(dst[isp].data_handle(), nvxvy, nxy),
+                DView2D(src[isp].data_handle(), nxy, nvxvy));
+    });
+    return dst;
+}
+
+/**
+ * @brief Copy the distribution function from the layout where the spatial dimensions are
+ * innermost back to the natural layout.
+ *
+ * @param[out] dst The distribution function in the natural layout.
+ * @param[in] src The distribution function with the spatial dimensions innermost.
+ *
+ * @return The distribution function in the natural layout.
+ */
+inline DSpanSpXYVxVy transpose_layout(DSpanSpXYVxVy const dst, DViewSpVxVyXY const src)
+{
+    std::size_t const nxy = ddc::select<IDimX, IDimY>(src.domain()).size();
+    std::size_t const nvxvy = ddc::select<IDimVx, IDimVy>(src.domain()).size();
+    assert(ddc::select<IDimSp>(dst.domain()) == ddc::select<IDimSp>(src.domain()));
+    assert(ddc::select<IDimX, IDimY>(dst.domain()) == ddc::select<IDimX, IDimY>(src.domain()));
+    assert(ddc::select<IDimVx, IDimVy>(dst.domain())
+           == ddc::select<IDimVx, IDimVy>(src.domain()));
+    ddc::for_each(ddc::get_domain<IDimSp>(src), [&](IndexSp const isp) {
+        transpose_blocked(
+                DSpan2D(dst[isp].data_handle(), nxy, nvxvy),
+                DView2D(src[isp].data_handle(), nvxvy, nxy));
+    });
+    return dst;
+}
@@ -0,0 +1,52 @@
+// SPDX-License-Identifier: MIT
+
+#include <cassert>
+
+#include "iadvectionvx.hpp"
+#include "iadvectionx.hpp"
+#include "transpose.hpp"
+#include "transposedsplitvlasovsolver.hpp"
+
+TransposedSplitVlasovSolver::TransposedSplitVlasovSolver(
+        IDomainSpXYVxVy const& dom,
+        IAdvectionSpatial<GeometryVxVyXY, IDimX> const& advec_x,
+        IAdvectionSpatial<GeometryVxVyXY, IDimY> const& advec_y,
+        IAdvectionVelocity<GeometryXYVxVy, IDimVx> const& advec_vx,
+        IAdvectionVelocity<GeometryXYVxVy, IDimVy> const& advec_vy)
+    : m_advec_x(advec_x)
+    , m_advec_y(advec_y)
+    , m_advec_vx(advec_vx)
+    , m_advec_vy(advec_vy)
+    , m_allfdistribu_transposed(IDomainSpVxVyXY(
+              ddc::select<IDimSp>(dom),
+              ddc::select<IDimVx>(dom),
+              ddc::select<IDimVy>(dom),
+              ddc::select<IDimX>(dom),
+              ddc::select<IDimY>(dom)))
+{
+}
+
+DSpanSpXYVxVy TransposedSplitVlasovSolver::operator()(
+        DSpanSpXYVxVy const allfdistribu,
+        DViewXY const electric_field_x,
+        DViewXY const electric_field_y,
+        double const dt) const
+{
+    assert(allfdistribu.domain().size() == m_allfdistribu_transposed.domain().size());
+    DSpanSpVxVyXY const allfdistribu_transposed = m_allfdistribu_transposed.span_view();
+
+    transpose_layout(allfdistribu_transposed, allfdistribu.span_cview());
+    m_advec_x(allfdistribu_transposed, dt / 2);
+    m_advec_y(allfdistribu_transposed, dt / 2);
+    transpose_layout(allfdistribu, m_allfdistribu_transposed.span_cview());
+
+    m_advec_vx(allfdistribu, electric_field_x, dt / 2);
+    m_advec_vy(allfdistribu, electric_field_y, dt);
+    m_advec_vx(allfdistribu, electric_field_x, dt / 2);
+
+    transpose_layout(allfdistribu_transposed, allfdistribu.span_cview());
+    m_advec_y(allfdistribu_transposed, dt / 2);
+    m_advec_x(allfdistribu_transposed, dt / 2);
+    transpose_layout(allfdistribu, m_allfdistribu_transposed.span_cview());
+    return allfdistribu;
+}
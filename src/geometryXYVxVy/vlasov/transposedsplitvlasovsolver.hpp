@@ -0,0 +1,57 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <geometry.hpp>
+
+#include "ivlasovsolver.hpp"
+
+template <class Geometry, class DDimX>
+class IAdvectionSpatial;
+template <class Geometry, class DDimV>
+class IAdvectionVelocity;
+
+/**
+ * @brief A Strang splitting of the Vlasov equation which switches the layout of the
+ * distribution function between the advections.
+ *
+ * The spatial advections are applied to a copy of the distribution function with the
+ * spatial dimensions innermost (GeometryVxVyXY). The velocity advections are applied in the
+ * natural layout (GeometryXYVxVy). The layout is switched with a tiled out-of-place transpose
+ * into a buffer which is allocated once for the domain given to the constructor.
+ */
+class TransposedSplitVlasovSolver : public IVlasovSolver
+{
+    IAdvectionSpatial<GeometryVxVyXY, IDimX> const& m_advec_x;
+    IAdvectionSpatial<GeometryVxVyXY, IDimY> const& m_advec_y;
+
+    IAdvectionVelocity<GeometryXYVxVy, IDimVx> const& m_advec_vx;
+    IAdvectionVelocity<GeometryXYVxVy, IDimVy> const& m_advec_vy;
+
+    // The distribution function with the spatial dimensions innermost
+    mutable DFieldSpVxVyXY m_allfdistribu_transposed;
+
+public:
+    /**
+     * @brief Create the splitting.
+     * @param[in] dom The domain of the distribution functions which will be advected.
+     * @param[in] advec_x The advection along x, in the transposed layout.
+     * @param[in] advec_y The advection along y, in the transposed layout.
+     * @param[in] advec_vx The advection along vx.
+     * @param[in] advec_vy The advection along vy.
+     */
+    TransposedSplitVlasovSolver(
+            IDomainSpXYVxVy const& dom,
+            IAdvectionSpatial<GeometryVxVyXY, IDimX> const& advec_x,
+            IAdvectionSpatial<GeometryVxVyXY, IDimY> const& advec_y,
+            IAdvectionVelocity<GeometryXYVxVy, IDimVx> const& advec_vx,
+            IAdvectionVelocity<GeometryXYVxVy, IDimVy> const& advec_vy);
+
+    ~TransposedSplitVlasovSolver() override = default;
+
+    DSpanSpXYVxVy operator()(
+            DSpanSpXYVxVy allfdistribu,
+            DViewXY electric_field_x,
+            DViewXY electric_field_y,
+            double dt) const override;
+};
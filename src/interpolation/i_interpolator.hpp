@@ -2,10 +2,15 @@
 
 #pragma once
 
+#include <array>
+#include <cassert>
 #include <memory>
+#include <type_traits>
 
 #include <ddc/ddc.hpp>
 
+#include <sll/view.hpp>
+
 /**
  * @brief A class which provides an interpolating function.
  *
@@ -35,6 +40,141 @@ public:
             ddc::ChunkSpan<double, ddc::DiscreteDomain<DDim>> inout_data,
             ddc::ChunkSpan<const ddc::Coordinate<CDim>, ddc::DiscreteDomain<DDim>> coordinates)
             const = 0;
+
+    /**
+     * @brief Approximate the values of a batch of functions at a set of coordinates using the
+     * current values at a known set of interpolation points.
+     *
+     * Each line of the 2D arrays describes one function. The second index runs over the
+     * interpolation points (respectively the coordinates) of this function.
+     *
+     * @param[in, out] inout_data On input: an array containing the values of the functions at the interpolation points.
+     * 			 On output: an array containing the values of the functions at the coordinates.
+     * @param[in] coordinates The coordinates where the functions should be evaluated.
+     *
+     * @return A reference to the inout_data array containing the values of the functions at the coordinates.
+     */
+    virtual DSpan2D_stride operator()(
+            DSpan2D_stride inout_data,
+            View2D_stride<ddc::Coordinate<CDim>> coordinates) const = 0;
+
+    /**
+     * @brief Approximate the values of a batch of functions at their interpolation points
+     * shifted by one displacement per function.
+     *
+     * The l-th function is evaluated at the coordinates of the interpolation points minus
+     * displacements(l), i.e. at the feet of the characteristics of a semi-Lagrangian step
+     * whose displacement is constant along each line. The feet are not stored.
+     *
+     * @param[in, out] inout_data On input: an array containing the values of the functions at the interpolation points.
+     * 			 On output: an array containing the values of the functions at the shifted points.
+     * @param[in] displacements The displacement of the interpolation points of each function.
+     *
+     * @return A reference to the inout_data array containing the values of the functions at the shifted points.
+     */
+    virtual DSpan2D_stride operator()(DSpan2D_stride inout_data, DView1D displacements) const = 0;
+
+    /**
+     * @brief Approximate the values of a batch of functions defined on a multi-dimensional domain.
+     *
+     * The functions are the 1D lines along DDim of inout_data. They are all interpolated
+     * together, directly in the memory of inout_data (which can be a non-contiguous slice).
+     * The dimensions other than DDim must be laid out such that they can be seen as a
+     * single batch dimension.
+     *
+     * @param[in, out] inout_data On input: an array containing the values of the functions at the interpolation points.
+     * 			 On output: an array containing the values of the functions at the coordinates.
+     * @param[in] coordinates The coordinates where the functions should be evaluated.
+     *
+     * @return A reference to the inout_data array containing the values of the functions at the coordinates.
+     */
+    template <class... DDims, class Layout, class CoordLayout>
+    ddc::ChunkSpan<double, ddc::DiscreteDomain<DDims...>, Layout> operator()(
+            ddc::ChunkSpan<double, ddc::DiscreteDomain<DDims...>, Layout> const inout_data,
+            ddc::ChunkSpan<const ddc::Coordinate<CDim>, ddc::DiscreteDomain<DDims...>, CoordLayout> const
+                    coordinates) const
+    {
+        static_assert(sizeof...(DDims) >= 2);
+        assert(inout_data.domain() == coordinates.domain());
+        if (!inout_data.domain().empty()) {
+            (*this)(as_lines(inout_data), as_lines(coordinates));
+        }
+        return inout_data;
+    }
+
+    /**
+     * @brief Approximate the values of a batch of functions defined on a multi-dimensional domain
+     * at their interpolation points shifted by one displacement per function.
+     *
+     * The functions are the 1D lines along DDim of inout_data, as in the interpolation at a set
+     * of coordinates. The displacements are defined on the other dimensions of inout_data.
+     *
+     * @param[in, out] inout_data On input: an array containing the values of the functions at the interpolation points.
+     * 			 On output: an array containing the values of the functions at the shifted points.
+     * @param[in] displacements The displacement of the interpolation points of each function.
+     *
+     * @return A reference to the inout_data array containing the values of the functions at the shifted points.
+     */
+    template <class... DDims, class Layout, class... BatchDDims>
+    ddc::ChunkSpan<double, ddc::DiscreteDomain<DDims...>, Layout> operator()(
+            ddc::ChunkSpan<double, ddc::DiscreteDomain<DDims...>, Layout> const inout_data,
+            ddc::ChunkSpan<const double, ddc::DiscreteDomain<BatchDDims...>> const displacements)
+            const
+    {
+        static_assert(sizeof...(DDims) >= 2);
+        assert(displacements.domain()
+               == ddc::remove_dims_of(
+                       inout_data.domain(),
+                       ddc::select<DDim>(inout_data.domain())));
+        if (!inout_data.domain().empty()) {
+            // the contiguous displacements are ordered as the lines returned by as_lines
+            (*this)(as_lines(inout_data),
+                    DView1D(displacements.data_handle(), displacements.domain().size()));
+        }
+        return inout_data;
+    }
+
+private:
+    /**
+     * @brief View the lines along DDim of a multi-dimensional ChunkSpan as the rows of a 2D array.
+     *
+     * @param[in] data The multi-dimensional ChunkSpan.
+     *
+     * @return A 2D view whose first index runs over the lines and second index runs over DDim.
+     */
+    template <class ElementType, class... DDims, class Layout>
+    static Span2D_stride<ElementType> as_lines(
+            ddc::ChunkSpan<ElementType, ddc::DiscreteDomain<DDims...>, Layout> const data)
+    {
+        constexpr std::size_t rank = sizeof...(DDims);
+        std::array<std::size_t, rank> const extents {
+                std::size_t(ddc::select<DDims>(data.domain()).size())...};
+        std::array<std::size_t, rank> const strides {std::size_t(data.template stride<DDims>())...};
+        std::array<bool, rank> const is_batch_dim {!std::is_same_v<DDims, DDim>...};
+
+        // Collapse the batch dimensions into one, starting from the innermost
+        std::size_t n_lines = 1;
+        std::size_t line_stride = 1;
+        bool first_batch_dim = true;
+        for (std::size_t i = rank; i-- > 0;) {
+            if (is_batch_dim[i] && extents[i] > 1) {
+                if (first_batch_dim) {
+                    line_stride = strides[i];
+                    first_batch_dim = false;
+                } else {
+                    assert(strides[i] == line_stride * n_lines);
+                }
+                n_lines *= extents[i];
+            }
+        }
+
+        std::experimental::layout_stride::mapping<std::experimental::dextents<std::size_t, 2>> const
+                mapping(std::experimental::dextents<std::size_t, 2>(
+                                n_lines,
+                                ddc::select<DDim>(data.domain()).size()),
+                        std::array<std::size_t, 2> {line_stride, data.template stride<DDim>()});
+        return Span2D_stride<ElementType>(data.data_handle(), mapping);
+    }
 };
 
 /**
@@ -66,6 +206,8 @@ class IPreallocatableInterpolator : public IInterpolator<DDim>
 public:
     ~IPreallocatableInterpolator() override = default;
 
+    using IInterpolator<DDim>::operator();
+
     /**
      * @brief Allocate an instance of an InterpolatorProxy to use as an IInterpolator.
      *
@@ -85,4 +227,17 @@ public:
     {
         return (*preallocate())(inout_data, coordinates);
     }
+
+    DSpan2D_stride operator()(
+            DSpan2D_stride const inout_data,
+            View2D_stride<ddc::Coordinate<CDim>> const coordinates) const override
+    {
+        return (*preallocate())(inout_data, coordinates);
+    }
+
+    DSpan2D_stride operator()(DSpan2D_stride const inout_data, DView1D const displacements)
+            const override
+    {
+        return (*preallocate())(inout_data, displacements);
+    }
 };
@@ -27,6 +27,11 @@ private:
 
     std::vector<double> m_derivs_max_alloc;
 
+    // Buffers used to interpolate a batch of lines, they grow with the size of the batch
+    mutable std::vector<double> m_batched_coefs_alloc;
+
+    mutable std::vector<double> m_batched_derivs_alloc;
+
 public:
     /**
      * @brief Create a spline interpolator object.
@@ -46,6 +51,8 @@ public:
 
     ~SplineInterpolator() override = default;
 
+    using IInterpolator<DDim>::operator();
+
     ddc::ChunkSpan<double, ddc::DiscreteDomain<DDim>> operator()(
             ddc::ChunkSpan<double, ddc::DiscreteDomain<DDim>> const inout_data,
             ddc::ChunkSpan<const ddc::Coordinate<CDim>, ddc::DiscreteDomain<DDim>> const
@@ -63,6 +70,54 @@ public:
         m_evaluator(inout_data, coordinates, m_coefs);
         return inout_data;
     }
+
+    DSpan2D_stride operator()(
+            DSpan2D_stride const inout_data,
+            View2D_stride<ddc::Coordinate<CDim>> const coordinates) const override
+    {
+        m_evaluator(inout_data, coordinates, build_batched_coefs(inout_data));
+        return inout_data;
+    }
+
+    DSpan2D_stride operator()(DSpan2D_stride const inout_data, DView1D const displacements)
+            const override
+    {
+        m_evaluator(
+                inout_data,
+                m_builder.interpolation_domain(),
+                displacements,
+                build_batched_coefs(inout_data));
+        return inout_data;
+    }
+
+private:
+    /**
+     * @brief Build the spline coefficients of a batch of lines in the batched buffers.
+     * @param[in] inout_data The values of the functions at the interpolation points, one line per function.
+     * @return The spline coefficients, one line per function.
+     */
+    DSpan2D build_batched_coefs(DSpan2D_stride const inout_data) const
+    {
+        std::size_t const n_lines = inout_data.extent(0);
+        std::size_t const n_coefs = m_builder.spline_domain().size();
+        std::size_t const n_derivs = BSplines::degree() / 2;
+        if (m_batched_coefs_alloc.size() < n_lines * n_coefs) {
+            m_batched_coefs_alloc.resize(n_lines * n_coefs);
+            m_batched_derivs_alloc.resize(n_lines * n_derivs, 0.);
+        }
+        DSpan2D const coefs(m_batched_coefs_alloc.data(), n_lines, n_coefs);
+
+        std::optional<CDSpan2D> derivs_min;
+        std::optional<CDSpan2D> derivs_max;
+        if constexpr (BcMin == BoundCond::HERMITE) {
+            derivs_min = CDSpan2D(m_batched_derivs_alloc.data(), n_lines, n_derivs);
+        }
+        if constexpr (BcMax == BoundCond::HERMITE) {
+            derivs_max = CDSpan2D(m_batched_derivs_alloc.data(), n_lines, n_derivs);
+        }
+        m_builder(coefs, inout_data, derivs_min, derivs_max);
+        return coefs;
+    }
 };
 
 /**
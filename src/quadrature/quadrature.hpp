@@ -52,4 +52,14 @@ public:
                     return m_coefficients(ix) * values(ix);
                 });
     }
+
+    /**
+     * @brief Get the coefficients of the quadrature.
+     *
+     * @returns A constant view on the coefficients of the quadrature.
+     */
+    ddc::ChunkSpan<const double, ddc::DiscreteDomain<IDim...>> coefficients() const
+    {
+        return m_coefficients.span_cview();
+    }
 };
@@ -0,0 +1,196 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <ddc/ddc.hpp>
+#include <ddc/pdi.hpp>
+
+/**
+ * @brief A class which triggers the output events of the time solvers from a background thread.
+ *
+ * The distribution function and the electrostatic potential are copied into one of a fixed
+ * number of staging buffers and the PDI event is triggered on this copy by a worker thread, so
+ * that the plugins (e.g. decl_hdf5) write the data while the solver computes the next
+ * iterations. When all the buffers are waiting to be written the caller is blocked until one of
+ * them is released, which bounds the memory used by the pending outputs.
+ *
+ * Only the iterations which are multiples of nbstep_output are copied, the others would be
+ * discarded by the `when` conditions of the PDI configuration. The last_iteration event is
+ * always copied.
+ *
+ * PDI is not thread-safe. No other PDI call should be made while outputs are pending, flush()
+ * must therefore be called before exposing other data or finalising PDI.
+ */
+template <class FdistribuDomain, class PotentialDomain>
+class AsyncPdiWriter
+{
+    struct Snapshot
+    {
+        std::string event;
+
+        int iter;
+
+        double time_saved;
+
+        ddc::Chunk<double, FdistribuDomain> fdistribu;
+
+        ddc::Chunk<double, PotentialDomain> electrostatic_potential;
+
+        Snapshot(FdistribuDomain const& fdistribu_dom, PotentialDomain const& potential_dom)
+            : iter(0)
+            , time_saved(0.)
+            , fdistribu(fdistribu_dom)
+            , electrostatic_potential(potential_dom)
+        {
+        }
+    };
+
+private:
+    int m_nbstep_output;
+
+    std::vector<Snapshot> m_snapshots;
+
+    // The indices of the snapshots which can be filled
+    std::vector<std::size_t> m_free;
+
+    // The indices of the snapshots waiting to be written, in the order of the iterations
+    std::deque<std::size_t> m_ready;
+
+    bool m_stop;
+
+    std::mutex m_mutex;
+
+    std::condition_variable m_cond;
+
+    std::thread m_worker;
+
+public:
+    /**
+     * @brief Create the staging buffers and start the worker thread.
+     * @param[in] fdistribu_dom The domain of the distribution function.
+     * @param[in] potential_dom The domain of the electrostatic potential.
+     * @param[in] nbstep_output The number of iterations between two outputs.
+     * @param[in] nbuffers The number of staging buffers, 2 allows one output to be written
+     *                     while the next one is copied.
+     */
+    AsyncPdiWriter(
+            FdistribuDomain const& fdistribu_dom,
+            PotentialDomain const& potential_dom,
+            int const nbstep_output,
+            std::size_t const nbuffers = 2)
+        : m_nbstep_output(nbstep_output)
+        , m_stop(false)
+    {
+        if (m_nbstep_output < 1 || nbuffers < 1) {
+            throw std::invalid_argument("AsyncPdiWriter needs nbstep_output >= 1 and a buffer.");
+        }
+        m_snapshots.reserve(nbuffers);
+        for (std::size_t ib = 0; ib < nbuffers; ++ib) {
+            m_snapshots.emplace_back(fdistribu_dom, potential_dom);
+            m_free.push_back(ib);
+        }
+        m_worker = std::thread([this]() { run(); });
+    }
+
+    AsyncPdiWriter(AsyncPdiWriter const& x) = delete;
+
+    AsyncPdiWriter(AsyncPdiWriter&& x) = delete;
+
+    /// Write the pending outputs and stop the worker thread.
+    ~AsyncPdiWriter()
+    {
+        {
+            std::lock_guard<std::mutex> const lock(m_mutex);
+            m_stop = true;
+        }
+        m_cond.notify_all();
+        m_worker.join();
+    }
+
+    AsyncPdiWriter& operator=(AsyncPdiWriter const& x) = delete;
+
+    AsyncPdiWriter& operator=(AsyncPdiWriter&& x) = delete;
+
+    /**
+     * @brief Copy the data of an output event and queue it for writing.
+     * @param[in] event The name of the PDI event, "iteration" or "last_iteration".
+     * @param[in] iter The iteration index.
+     * @param[in] time_saved The time of the iteration.
+     * @param[in] fdistribu The distribution function.
+     * @param[in] electrostatic_potential The electrostatic potential.
+     */
+    void operator()(
+            std::string const& event,
+            int const iter,
+            double const time_saved,
+            ddc::ChunkSpan<double const, FdistribuDomain> const fdistribu,
+            ddc::ChunkSpan<double const, PotentialDomain> const electrostatic_potential)
+    {
+        if (event == "iteration" && iter % m_nbstep_output != 0) {
+            return;
+        }
+
+        std::size_t ib;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_cond.wait(lock, [&]() { return !m_free.empty(); });
+            ib = m_free.back();
+            m_free.pop_back();
+        }
+
+        Snapshot& snapshot = m_snapshots[ib];
+        snapshot.event = event;
+        snapshot.iter = iter;
+        snapshot.time_saved = time_saved;
+        ddc::deepcopy(snapshot.fdistribu, fdistribu);
+        ddc::deepcopy(snapshot.electrostatic_potential, electrostatic_potential);
+
+        {
+            std::lock_guard<std::mutex> const lock(m_mutex);
+            m_ready.push_back(ib);
+        }
+        m_cond.notify_all();
+    }
+
+    /// Wait until all the queued outputs are written.
+    void flush()
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_cond.wait(lock, [&]() { return m_free.size() == m_snapshots.size(); });
+    }
+
+private:
+    void run()
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        while (true) {
+            m_cond.wait(lock, [&]() { return m_stop || !m_ready.empty(); });
+            if (m_ready.empty()) {
+                return;
+            }
+            std::size_t const ib = m_ready.front();
+            m_ready.pop_front();
+            lock.unlock();
+
+            Snapshot& snapshot = m_snapshots[ib];
+            ddc::PdiEvent(snapshot.event)
+                    .with("iter", snapshot.iter)
+                    .and_with("time_saved", snapshot.time_saved)
+                    .and_with("fdistribu", snapshot.fdistribu)
+                    .and_with("electrostatic_potential", snapshot.electrostatic_potential);
+
+            lock.lock();
+            m_free.push_back(ib);
+            m_cond.notify_all();
+        }
+    }
+};
@@ -0,0 +1,136 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <algorithm>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include <ddc/ddc.hpp>
+#include <ddc/pdi.hpp>
+
+#include <paraconf.h>
+#include <paraconfpp.hpp>
+#include <pdi.h>
+
+/**
+ * @brief Parse the command line of a simulation.
+ *
+ * The accepted command lines are `<config_file.yml> [--restart <checkpoint_file.h5>]`, which
+ * runs the simulation, and `--dump-config <config_file.yml>`, which writes the default
+ * parameters.
+ *
+ * @param[out] conf_voicexx The parsed configuration of the simulation.
+ * @param[out] restart_file The checkpoint to restart from, empty for a new run.
+ * @param[in] argc The number of arguments of the executable.
+ * @param[in] argv The arguments of the executable.
+ * @param[in] params_yaml The default parameters of the simulation.
+ * @return The exit status of the executable if the simulation must not be run, std::nullopt
+ *         otherwise.
+ */
+inline std::optional<int> parse_executable_arguments(
+        PC_tree_t& conf_voicexx,
+        std::string& restart_file,
+        int const argc,
+        char** const argv,
+        char const* const params_yaml)
+{
+    restart_file.clear();
+    if (argc == 2) {
+        conf_voicexx = PC_parse_path(std::filesystem::path(argv[1]).c_str());
+        return std::nullopt;
+    }
+    if (argc == 4 && argv[2] == std::string_view("--restart")) {
+        conf_voicexx = PC_parse_path(std::filesystem::path(argv[1]).c_str());
+        restart_file = argv[3];
+        return std::nullopt;
+    }
+    if (argc == 3 && argv[1] == std::string_view("--dump-config")) {
+        std::fstream file(argv[2], std::fstream::out);
+        file << params_yaml;
+        return EXIT_SUCCESS;
+    }
+    std::cerr << "usage: " << argv[0] << " [--dump-config] <config_file.yml>"
+              << " [--restart <checkpoint_file.h5>]" << std::endl;
+    return EXIT_FAILURE;
+}
+
+/**
+ * @brief Read the period of an output and convert it to a number of iterations.
+ * @param[in] conf_voicexx The configuration of the simulation.
+ * @param[in] key The path of the period in the configuration, e.g. ".Output.time_checkpoint".
+ * @param[in] deltat The time step of the simulation.
+ * @param[in] nbstep_default The number of iterations used if the period is not given.
+ * @return The number of iterations between two outputs, at least 1 if the period is given.
+ */
+inline int read_nbstep(
+        PC_tree_t const conf_voicexx,
+        std::string const& key,
+        double const deltat,
+        int const nbstep_default)
+{
+    if (PC_status(PCpp_get(conf_voicexx, key)) != PC_OK) {
+        return nbstep_default;
+    }
+    return std::max(1, int(PCpp_double(conf_voicexx, key) / deltat));
+}
+
+/**
+ * @brief Read an optional integer of the configuration.
+ * @param[in] conf_voicexx The configuration of the simulation.
+ * @param[in] key The path of the integer in the configuration.
+ * @param[in] default_value The value used if the integer is not given.
+ * @return The integer.
+ */
+inline int read_int(PC_tree_t const conf_voicexx, std::string const& key, int const default_value)
+{
+    if (PC_status(PCpp_get(conf_voicexx, key)) != PC_OK) {
+        return default_value;
+    }
+    return static_cast<int>(PCpp_int(conf_voicexx, key));
+}
+
+/**
+ * @brief Initialise the distribution function of a new run, or read it from a checkpoint.
+ *
+ * The checkpoint is read by the "restart" PDI event, which reads its iteration in
+ * "iter_restart" and the distribution function in "fdistribu" from the file "restart_file".
+ * The first iteration is then exposed to PDI as "iter_start", so that the checkpoint the run
+ * restarted from is not overwritten.
+ *
+ * Only the distribution function is read: the time solvers which keep a history of the past
+ * iterations (ExtrapolatedPredCorr, AdaptivePredCorr) expose it with their "iteration" events
+ * and must be given it back with their set_history() method to restart exactly.
+ *
+ * @param[in] restart_file The checkpoint to restart from, empty for a new run.
+ * @param[out] allfdistribu The distribution function.
+ * @param[in] init The operator initialising the distribution function of a new run.
+ * @return The first iteration of the run.
+ */
+template <class Initialization, class FdistribuSpan>
+int initialize_or_restart(
+        std::string const& restart_file,
+        FdistribuSpan const allfdistribu,
+        Initialization const& init)
+{
+    int iter_start = 0;
+    if (restart_file.empty()) {
+        init(allfdistribu);
+    } else {
+        // continue a previous run from one of its checkpoints
+        int const restart_file_size = static_cast<int>(restart_file.size());
+        ddc::expose_to_pdi("restart_file_size", restart_file_size);
+        PDI_expose("restart_file", restart_file.data(), PDI_OUT);
+        ddc::PdiEvent("restart")
+                .with("iter_restart", iter_start)
+                .and_with("fdistribu", allfdistribu);
+    }
+    // the run restarted from the checkpoint of iter_start does not overwrite it
+    ddc::expose_to_pdi("iter_start", iter_start);
+    return iter_start;
+}
@@ -11,6 +11,8 @@ import sys
 from argparse import ArgumentParser
 from pathlib import Path
 
+import numpy as np
+
 import diag_efield as Ediag
 from gysdata import DiskStore
 
@@ -39,13 +41,21 @@ if __name__ == '__main__':
     epot = ds['electrostatic_potential']
     epot = epot.isel(x=int(epot.sizes["x"] / 2))
 
+    # The amplitude of the electric field, sqrt(2 W), decays like the potential. It is taken
+    # from the reduced diagnostics when the simulation computes them, as they are saved more
+    # often than the potential, otherwise from the potential in the middle of the domain.
+    if 'field_energy' in ds.get_data():
+        amplitude = np.sqrt(2 * ds['field_energy'])
+    else:
+        amplitude = epot
+
     # Compute and plot the growth (or damping) rate
     (fitted_values, fit,
-     growthrate_computed, valid_growthrate) = Ediag.compute_growthrate(epot,
+     growthrate_computed, valid_growthrate) = Ediag.compute_growthrate(amplitude,
                                                                        args.growthrate)
-    growthrate_outfile = Path(f'growthrate_t{epot.coords["time"].values[0]}'
-                              f'to{epot.coords["time"].values[-1]}.png')
-    Ediag.plot_growthrate(growthrate_outfile, abs(epot), fitted_values, fit,
+    growthrate_outfile = Path(f'growthrate_t{amplitude.coords["time"].values[0]}'
+                              f'to{amplitude.coords["time"].values[-1]}.png')
+    Ediag.plot_growthrate(growthrate_outfile, abs(amplitude), fitted_values, fit,
                           growthrate_computed, args.growthrate)
 
     # Compute and plot the growth (or damping) rate
@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: MIT
 
 #include <chrono>
+#include <cmath>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
@@ -152,7 +153,11 @@ int main(int argc, char** argv)
               << "ms" << std::endl;
     start_time = std::chrono::system_clock::now();
 
-    PoissonSolver solver(coeff_alpha_spline, coeff_beta_spline, discrete_mapping);
+    PoissonSolver solver(
+            coeff_alpha_spline,
+            coeff_beta_spline,
+            discrete_mapping,
+            PolarLinearSolverType::Cholesky);
 
     end_time = std::chrono::system_clock::now();
     std::cout << "Poisson initialisation time : "
@@ -169,27 +174,20 @@ int main(int argc, char** argv)
                 ddc::coordinate(ddc::select<IDimR>(irp)),
                 ddc::coordinate(ddc::select<IDimP>(irp)));
     });
-    if (discrete_rhs) {
-        Spline2D rhs_spline(dom_bsplinesRP);
-        DFieldRP rhs_vals(grid);
-        ddc::for_each(grid, [&](IndexRP const irp) { rhs_vals(irp) = rhs(coords(irp)); });
-        builder(rhs_spline, rhs_vals);
-
-        start_time = std::chrono::system_clock::now();
-        SplineEvaluator2D
-                eval(g_null_boundary_2d<BSplinesR, BSplinesP>,
-                     g_null_boundary_2d<BSplinesR, BSplinesP>,
-                     g_null_boundary_2d<BSplinesR, BSplinesP>,
-                     g_null_boundary_2d<BSplinesR, BSplinesP>);
-        solver([&](CoordRP const& coord) { return eval(coord, rhs_spline); },
-               coords.span_cview(),
-               result.span_view());
-        end_time = std::chrono::system_clock::now();
-    } else {
-        start_time = std::chrono::system_clock::now();
-        solver(rhs, coords.span_cview(), result.span_view());
-        end_time = std::chrono::system_clock::now();
-    }
+    auto const solve = [&](PoissonSolver const& poisson_solver, DSpanRP const solution) {
+        if (discrete_rhs) {
+            Spline2D rhs_spline(dom_bsplinesRP);
+            DFieldRP rhs_vals(grid);
+            ddc::for_each(grid, [&](IndexRP const irp) { rhs_vals(irp) = rhs(coords(irp)); });
+            builder(rhs_spline, rhs_vals);
+            poisson_solver(rhs_spline.span_cview(), coords.span_cview(), solution);
+        } else {
+            poisson_solver(rhs, coords.span_cview(), solution);
+        }
+    };
+    start_time = std::chrono::system_clock::now();
+    solve(solver, result.span_view());
+    end_time = std::chrono::system_clock::now();
     std::cout << "Solver time : "
               << std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time)
                          .count()
@@ -204,6 +202,30 @@ int main(int argc, char** argv)
             max_err = max_err > -err ? max_err : -err;
         }
     });
+
+    // The same problem solved with the iterative linear solver
+    PoissonSolver solver_cg(
+            coeff_alpha_spline,
+            coeff_beta_spline,
+            discrete_mapping,
+            PolarLinearSolverType::ConjugateGradient);
+    DFieldRP result_cg(grid);
+    start_time = std::chrono::system_clock::now();
+    solve(solver_cg, result_cg.span_view());
+    end_time = std::chrono::system_clock::now();
+    std::cout << "Conjugate gradient solver time : "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time)
+                         .count()
+              << "ms" << std::endl;
+
+    double max_err_cg = 0.0;
+    double max_diff_cg = 0.0;
+    ddc::for_each(grid, [&](IndexRP const irp) {
+        max_err_cg = std::fmax(max_err_cg, std::fabs(result_cg(irp) - lhs(coords(irp))));
+        max_diff_cg = std::fmax(max_diff_cg, std::fabs(result_cg(irp) - result(irp)));
+    });
+    std::cout << "Max difference with the conjugate gradient : " << max_diff_cg << std::endl;
+    std::cout << "Max error with the conjugate gradient : " << max_err_cg << std::endl;
     std::cout << "Max error : " << max_err << std::endl;
 
     return 0;
@@ -1,6 +1,7 @@
 #!/usr/bin/python3
 """ A file used for testing polarpoissonfemsolver.cpp. It provides 2 input files of different sizes and uses the results to calculate the order of convergence.
 Cubic splines should produce 4th order convergence. As few points are used the convergence order will not yet have converged so we simply verify that order > 3.5.
+The problem is solved with the Cholesky factorisation and with the conjugate gradient, whose solutions should agree.
 
 Inputs: the executable associated with the file polarpoissonfemsolver.cpp.
 """
@@ -29,6 +30,8 @@ if err:
 
 out_lines = out.split('\n')
 error_64 = float(out_lines[-1].split(' ')[-1])
+error_cg_64 = float(out_lines[-2].split(' ')[-1])
+difference_cg_64 = float(out_lines[-3].split(' ')[-1])
 
 with open("poisson.yaml", "w", encoding="utf-8") as f:
     print("Mesh:", file=f)
@@ -48,9 +51,20 @@ if err:
 
 out_lines = out.split('\n')
 error_128 = float(out_lines[-1].split(' ')[-1])
+error_cg_128 = float(out_lines[-2].split(' ')[-1])
+difference_cg_128 = float(out_lines[-3].split(' ')[-1])
 
 order = np.log(error_64/error_128) / np.log(2)
 
 print("Measured order : ", order)
 
 assert 3.5 < order
+
+# The conjugate gradient gives the solution of the direct solver up to its tolerance
+order_cg = np.log(error_cg_64/error_cg_128) / np.log(2)
+
+print("Measured order with the conjugate gradient : ", order_cg)
+
+assert 3.5 < order_cg
+assert difference_cg_64 < 1e-7
+assert difference_cg_128 < 1e-7
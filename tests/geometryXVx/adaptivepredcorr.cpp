@@ -0,0 +1,207 @@
+// SPDX-License-Identifier: MIT
+
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+#include <ddc/ddc.hpp>
+
+#include <gtest/gtest.h>
+
+#include <paraconf.h>
+#include <pdi.h>
+
+#include "adaptivepredcorr.hpp"
+#include "geometry.hpp"
+#include "iboltzmannsolver.hpp"
+#include "landau_test_case.hpp"
+#include "predcorr.hpp"
+
+namespace {
+
+/**
+ * A Boltzmann solver which records the time steps of the corrections, i.e. of the advances
+ * of the distribution function given to the time solver.
+ */
+class RecordingBoltzmannSolver : public IBoltzmannSolver
+{
+    IBoltzmannSolver const& m_solver;
+
+    double const* m_fdistribu;
+
+    mutable std::vector<double> m_steps;
+
+public:
+    RecordingBoltzmannSolver(IBoltzmannSolver const& solver, DViewSpXVx const allfdistribu)
+        : m_solver(solver)
+        , m_fdistribu(allfdistribu.data_handle())
+    {
+    }
+
+    DSpanSpXVx operator()(DSpanSpXVx const allfdistribu, DViewX const efield, double const dt)
+            const override
+    {
+        if (allfdistribu.data_handle() == m_fdistribu) {
+            m_steps.push_back(dt);
+        }
+        return m_solver(allfdistribu, efield, dt);
+    }
+
+    std::vector<double> const& steps() const
+    {
+        return m_steps;
+    }
+};
+
+} // namespace
+
+TEST(AdaptivePredCorr, OutputTimes)
+{
+    PC_tree_t conf_pdi = PC_parse_string("");
+    PDI_init(conf_pdi);
+
+    LandauTestCase const landau;
+    DFieldSpXVx allfdistribu(landau.mesh);
+    landau.initialize(allfdistribu);
+
+    RecordingBoltzmannSolver const vlasov(landau.vlasov, allfdistribu);
+    // dt_max is not a divisor of the interval between the outputs so the sub-steps are cut
+    AdaptivePredCorr const time_solver(vlasov, landau.poisson, 1.e-4, 0.15, 1.e-3, 2.);
+
+    double const dt = 0.4;
+    int const nbiter = 5;
+    time_solver(allfdistribu, dt, nbiter);
+
+    // the time reached after each sub-step
+    std::vector<double> times;
+    double time = 0.;
+    for (double const dt_sub : vlasov.steps()) {
+        EXPECT_LE(dt_sub, 0.15 * (1. + 1.e-12));
+        time += dt_sub;
+        times.push_back(time);
+    }
+
+    // each output time is reached exactly by a sub-step
+    for (int iter = 1; iter <= nbiter; ++iter) {
+        double smallest_gap = std::fabs(times.front() - iter * dt);
+        for (double const t : times) {
+            smallest_gap = std::fmin(smallest_gap, std::fabs(t - iter * dt));
+        }
+        EXPECT_LE(smallest_gap, 1.e-12);
+    }
+    EXPECT_NEAR(times.back(), nbiter * dt, 1.e-12);
+
+    PC_tree_destroy(&conf_pdi);
+    PDI_finalize();
+}
+
+TEST(AdaptivePredCorr, StepsAfterOutputs)
+{
+    PC_tree_t conf_pdi = PC_parse_string("");
+    PDI_init(conf_pdi);
+
+    LandauTestCase const landau;
+    DFieldSpXVx allfdistribu(landau.mesh);
+    landau.initialize(allfdistribu);
+
+    // with a loose tolerance the steps are only limited by the displacements along x, which
+    // leaves a short sub-step before each output
+    RecordingBoltzmannSolver const vlasov(landau.vlasov, allfdistribu);
+    AdaptivePredCorr const time_solver(vlasov, landau.poisson, 1.e-4, 0.15, 1.e-1, 2.);
+
+    double const dt = 0.4;
+    int const nbiter = 4;
+    time_solver(allfdistribu, dt, nbiter);
+
+    double max_step = 0.;
+    for (double const dt_sub : vlasov.steps()) {
+        max_step = std::fmax(max_step, dt_sub);
+    }
+
+    // the steps which do not reach an output are not shrunk by the short sub-steps
+    double time = 0.;
+    for (double const dt_sub : vlasov.steps()) {
+        time += dt_sub;
+        double const time_to_output = std::fabs(time - std::round(time / dt) * dt);
+        if (time_to_output > 1.e-12) {
+            EXPECT_NEAR(dt_sub, max_step, 1.e-12);
+        }
+    }
+
+    PC_tree_destroy(&conf_pdi);
+    PDI_finalize();
+}
+
+TEST(AdaptivePredCorr, SplitCalls)
+{
+    PC_tree_t conf_pdi = PC_parse_string("");
+    PDI_init(conf_pdi);
+
+    LandauTestCase const landau;
+    double const dt = 0.4;
+
+    AdaptivePredCorr const time_solver(landau.vlasov, landau.poisson, 1.e-4, 0.15, 1.e-3, 2.);
+    DFieldSpXVx allfdistribu(landau.mesh);
+    landau.initialize(allfdistribu);
+    time_solver(allfdistribu, dt, 5);
+
+    // the history of the steps is kept between calls continuing the same simulation
+    AdaptivePredCorr const split_solver(landau.vlasov, landau.poisson, 1.e-4, 0.15, 1.e-3, 2.);
+    DFieldSpXVx allfdistribu_split(landau.mesh);
+    landau.initialize(allfdistribu_split);
+    split_solver(allfdistribu_split, dt, 2);
+    split_solver(allfdistribu_split, dt, 3, 2);
+
+    EXPECT_EQ(max_difference(allfdistribu_split, allfdistribu), 0.);
+
+    PC_tree_destroy(&conf_pdi);
+    PDI_finalize();
+}
+
+TEST(AdaptivePredCorr, Tolerance)
+{
+    PC_tree_t conf_pdi = PC_parse_string("");
+    PDI_init(conf_pdi);
+
+    LandauTestCase const landau;
+    double const final_time = 4.;
+    double const dt = 0.5;
+    int const nbiter = static_cast<int>(std::lround(final_time / dt));
+
+    // a second order reference with a small time step
+    PredCorr const predcorr(landau.vlasov, landau.poisson);
+    DFieldSpXVx allfdistribu_ref(landau.mesh);
+    landau.initialize(allfdistribu_ref);
+    double const dt_ref = 0.01;
+    predcorr(allfdistribu_ref, dt_ref, static_cast<int>(std::lround(final_time / dt_ref)));
+
+    double const loose_tolerance = 1.e-3;
+    AdaptivePredCorr const
+            loose_solver(landau.vlasov, landau.poisson, 1.e-4, dt, loose_tolerance, 4.);
+    DFieldSpXVx allfdistribu_loose(landau.mesh);
+    landau.initialize(allfdistribu_loose);
+    loose_solver(allfdistribu_loose, dt, nbiter);
+    double const error_loose = max_difference(allfdistribu_loose, allfdistribu_ref);
+
+    double const tight_tolerance = 1.e-5;
+    AdaptivePredCorr const
+            tight_solver(landau.vlasov, landau.poisson, 1.e-4, dt, tight_tolerance, 4.);
+    DFieldSpXVx allfdistribu_tight(landau.mesh);
+    landau.initialize(allfdistribu_tight);
+    tight_solver(allfdistribu_tight, dt, nbiter);
+    double const error_tight = max_difference(allfdistribu_tight, allfdistribu_ref);
+
+    // the local errors on the field accumulate over the simulated time
+    EXPECT_LE(error_loose, 10. * loose_tolerance);
+    EXPECT_LE(error_tight, error_loose);
+
+    // a tolerance which cannot be reached with dt_min is reported
+    AdaptivePredCorr const
+            unreachable_solver(landau.vlasov, landau.poisson, dt, dt, 1.e-14, 4.);
+    DFieldSpXVx allfdistribu(landau.mesh);
+    landau.initialize(allfdistribu);
+    EXPECT_THROW(unreachable_solver(allfdistribu, dt, nbiter), std::runtime_error);
+
+    PC_tree_destroy(&conf_pdi);
+    PDI_finalize();
+}
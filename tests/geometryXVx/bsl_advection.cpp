@@ -0,0 +1,206 @@
+// SPDX-License-Identifier: MIT
+
+#include <cmath>
+
+#include <ddc/ddc.hpp>
+
+#include <sll/constant_extrapolation_boundary_value.hpp>
+#include <sll/spline_evaluator.hpp>
+
+#include <gtest/gtest.h>
+
+#include <bsl_advection_vx.hpp>
+#include <bsl_advection_x.hpp>
+#include <geometry.hpp>
+#include <spline_interpolator.hpp>
+
+namespace {
+
+using PreallocatableSplineInterpolatorX
+        = PreallocatableSplineInterpolator<IDimX, BSplinesX, SplineXBoundary, SplineXBoundary>;
+using PreallocatableSplineInterpolatorVx = PreallocatableSplineInterpolator<
+        IDimVx,
+        BSplinesVx,
+        BoundCond::HERMITE,
+        BoundCond::HERMITE>;
+
+double gaussian(double const x, double const x0, double const sigma)
+{
+    return std::exp(-(x - x0) * (x - x0) / (sigma * sigma));
+}
+
+class BslAdvectionTest : public ::testing::Test
+{
+protected:
+    CoordX const x_min = CoordX(0.0);
+    CoordX const x_max = CoordX(1.0);
+    IVectX const x_size = IVectX(100);
+
+    CoordVx const vx_min = CoordVx(-6.0);
+    CoordVx const vx_max = CoordVx(6.0);
+    IVectVx const vx_size = IVectVx(100);
+
+    IDomainSp const dom_sp = IDomainSp(IndexSp(0), IVectSp(2));
+    IndexSp const my_ielec = dom_sp.front();
+    IndexSp const my_iion = dom_sp.back();
+
+    void SetUp() override
+    {
+        ddc::init_discrete_space<BSplinesX>(x_min, x_max, x_size);
+        ddc::init_discrete_space<BSplinesVx>(vx_min, vx_max, vx_size);
+
+        ddc::init_discrete_space<IDimX>(SplineInterpPointsX::get_sampling());
+        ddc::init_discrete_space<IDimVx>(SplineInterpPointsVx::get_sampling());
+
+        FieldSp<int> charges(dom_sp);
+        charges(my_ielec) = -1;
+        charges(my_iion) = 1;
+        DFieldSp masses(dom_sp);
+        masses(my_ielec) = 1.;
+        masses(my_iion) = 4.;
+        FieldSp<int> init_perturb_mode(dom_sp);
+        ddc::fill(init_perturb_mode, 0);
+        DFieldSp init_perturb_amplitude(dom_sp);
+        ddc::fill(init_perturb_amplitude, 0);
+
+        ddc::init_discrete_space<IDimSp>(
+                std::move(charges),
+                std::move(masses),
+                std::move(init_perturb_amplitude),
+                std::move(init_perturb_mode));
+    }
+};
+
+} // namespace
+
+TEST_F(BslAdvectionTest, SpatialAdvection)
+{
+    IDomainX const gridx(SplineInterpPointsX::get_domain());
+    IDomainVx const gridvx(SplineInterpPointsVx::get_domain());
+    IDomainSpXVx const mesh(dom_sp, gridx, gridvx);
+
+    SplineXBuilder const builder_x(gridx);
+    ConstantExtrapolationBoundaryValue<BSplinesX> const bv_x_min(x_min);
+    ConstantExtrapolationBoundaryValue<BSplinesX> const bv_x_max(x_max);
+    SplineEvaluator<BSplinesX> const spline_x_evaluator(bv_x_min, bv_x_max);
+    PreallocatableSplineInterpolatorX const spline_x_interpolator(builder_x, spline_x_evaluator);
+    BslAdvectionSpatial<GeometryXVx, IDimX> const advection_x(spline_x_interpolator);
+
+    double const dt = 0.01;
+
+    DFieldSpXVx allfdistribu(mesh);
+    ddc::for_each(mesh, [&](IndexSpXVx const ispxvx) {
+        double const x = ddc::coordinate(ddc::select<IDimX>(ispxvx));
+        double const vx = ddc::coordinate(ddc::select<IDimVx>(ispxvx));
+        allfdistribu(ispxvx) = gaussian(x, 0.5, 0.1) * gaussian(vx, 0., 1.);
+    });
+
+    advection_x(allfdistribu, dt);
+
+    double max_error = 0.;
+    ddc::for_each(mesh, [&](IndexSpXVx const ispxvx) {
+        IndexSp const isp = ddc::select<IDimSp>(ispxvx);
+        double const x = ddc::coordinate(ddc::select<IDimX>(ispxvx));
+        double const vx = ddc::coordinate(ddc::select<IDimVx>(ispxvx));
+        double const dx = std::sqrt(mass(my_ielec) / mass(isp)) * dt * vx;
+        double const exact = gaussian(x - dx, 0.5, 0.1) * gaussian(vx, 0., 1.);
+        max_error = std::fmax(max_error, std::fabs(allfdistribu(ispxvx) - exact));
+    });
+    EXPECT_LE(max_error, 1.e-4);
+}
+
+TEST_F(BslAdvectionTest, VelocityAdvection)
+{
+    IDomainX const gridx(SplineInterpPointsX::get_domain());
+    IDomainVx const gridvx(SplineInterpPointsVx::get_domain());
+    IDomainSpXVx const mesh(dom_sp, gridx, gridvx);
+
+    SplineVxBuilder const builder_vx(gridvx);
+    ConstantExtrapolationBoundaryValue<BSplinesVx> const bv_v_min(vx_min);
+    ConstantExtrapolationBoundaryValue<BSplinesVx> const bv_v_max(vx_max);
+    SplineEvaluator<BSplinesVx> const spline_vx_evaluator(bv_v_min, bv_v_max);
+    PreallocatableSplineInterpolatorVx const
+            spline_vx_interpolator(builder_vx, spline_vx_evaluator);
+    BslAdvectionVelocity<GeometryXVx, IDimVx> const advection_vx(spline_vx_interpolator);
+
+    double const dt = 0.1;
+
+    DFieldX electric_field(gridx);
+    ddc::for_each(gridx, [&](IndexX const ix) {
+        electric_field(ix) = std::sin(2. * M_PI * ddc::coordinate(ix));
+    });
+
+    DFieldSpXVx allfdistribu(mesh);
+    ddc::for_each(mesh, [&](IndexSpXVx const ispxvx) {
+        double const vx = ddc::coordinate(ddc::select<IDimVx>(ispxvx));
+        allfdistribu(ispxvx) = gaussian(vx, 0., 1.);
+    });
+
+    advection_vx(allfdistribu, electric_field.span_cview(), dt);
+
+    double max_error = 0.;
+    ddc::for_each(mesh, [&](IndexSpXVx const ispxvx) {
+        IndexSp const isp = ddc::select<IDimSp>(ispxvx);
+        IndexX const ix = ddc::select<IDimX>(ispxvx);
+        double const vx = ddc::coordinate(ddc::select<IDimVx>(ispxvx));
+        double const dvx = charge(isp) * std::sqrt(mass(my_ielec) / mass(isp)) * dt
+                           * electric_field(ix);
+        double const exact = gaussian(vx - dvx, 0., 1.);
+        max_error = std::fmax(max_error, std::fabs(allfdistribu(ispxvx) - exact));
+    });
+    EXPECT_LE(max_error, 1.e-4);
+}
+
+TEST_F(BslAdvectionTest, ParallelAdvection)
+{
+    IDomainX const gridx(SplineInterpPointsX::get_domain());
+    IDomainVx const gridvx(SplineInterpPointsVx::get_domain());
+    IDomainSpXVx const mesh(dom_sp, gridx, gridvx);
+
+    SplineXBuilder const builder_x(gridx);
+    ConstantExtrapolationBoundaryValue<BSplinesX> const bv_x_min(x_min);
+    ConstantExtrapolationBoundaryValue<BSplinesX> const bv_x_max(x_max);
+    SplineEvaluator<BSplinesX> const spline_x_evaluator(bv_x_min, bv_x_max);
+    PreallocatableSplineInterpolatorX const spline_x_interpolator(builder_x, spline_x_evaluator);
+
+    SplineVxBuilder const builder_vx(gridvx);
+    ConstantExtrapolationBoundaryValue<BSplinesVx> const bv_v_min(vx_min);
+    ConstantExtrapolationBoundaryValue<BSplinesVx> const bv_v_max(vx_max);
+    SplineEvaluator<BSplinesVx> const spline_vx_evaluator(bv_v_min, bv_v_max);
+    PreallocatableSplineInterpolatorVx const
+            spline_vx_interpolator(builder_vx, spline_vx_evaluator);
+
+    BslAdvectionSpatial<GeometryXVx, IDimX> const advection_x(spline_x_interpolator);
+    BslAdvectionVelocity<GeometryXVx, IDimVx> const advection_vx(spline_vx_interpolator);
+    BslAdvectionSpatial<GeometryXVx, IDimX, ddc::parallel_host_policy> const parallel_advection_x(
+            spline_x_interpolator);
+    BslAdvectionVelocity<GeometryXVx, IDimVx, ddc::parallel_host_policy> const
+            parallel_advection_vx(spline_vx_interpolator);
+
+    double const dt = 0.1;
+
+    DFieldX electric_field(gridx);
+    ddc::for_each(gridx, [&](IndexX const ix) {
+        electric_field(ix) = std::sin(2. * M_PI * ddc::coordinate(ix));
+    });
+
+    DFieldSpXVx allfdistribu(mesh);
+    ddc::for_each(mesh, [&](IndexSpXVx const ispxvx) {
+        double const x = ddc::coordinate(ddc::select<IDimX>(ispxvx));
+        double const vx = ddc::coordinate(ddc::select<IDimVx>(ispxvx));
+        allfdistribu(ispxvx) = gaussian(x, 0.5, 0.1) * gaussian(vx, 0., 1.);
+    });
+    DFieldSpXVx allfdistribu_parallel(mesh);
+    ddc::deepcopy(allfdistribu_parallel, allfdistribu);
+
+    advection_x(allfdistribu, dt);
+    advection_vx(allfdistribu, electric_field.span_cview(), dt);
+
+    parallel_advection_x(allfdistribu_parallel, dt);
+    parallel_advection_vx(allfdistribu_parallel, electric_field.span_cview(), dt);
+
+    // The lines are independent so the result does not depend on the distribution of the work
+    ddc::for_each(mesh, [&](IndexSpXVx const ispxvx) {
+        EXPECT_DOUBLE_EQ(allfdistribu_parallel(ispxvx), allfdistribu(ispxvx));
+    });
+}
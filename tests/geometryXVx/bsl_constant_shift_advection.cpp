@@ -0,0 +1,87 @@
+// SPDX-License-Identifier: MIT
+
+#include <cmath>
+
+#include <ddc/ddc.hpp>
+
+#include <sll/constant_extrapolation_boundary_value.hpp>
+#include <sll/spline_evaluator.hpp>
+
+#include <gtest/gtest.h>
+
+#include <bsl_advection_x.hpp>
+#include <bsl_constant_shift_advection_x.hpp>
+#include <geometry.hpp>
+#include <spline_interpolator.hpp>
+
+TEST(BslConstantShiftAdvection, SameAsBslAdvection)
+{
+    CoordX const x_min(0.0);
+    CoordX const x_max(2.0 * M_PI);
+    IVectX const x_size(64);
+
+    CoordVx const vx_min(-6.0);
+    CoordVx const vx_max(6.0);
+    IVectVx const vx_size(50);
+
+    IDomainSp const dom_sp(IndexSp(0), IVectSp(2));
+    IndexSp const my_ielec = dom_sp.front();
+    IndexSp const my_iion = dom_sp.back();
+
+    ddc::init_discrete_space<BSplinesX>(x_min, x_max, x_size);
+    ddc::init_discrete_space<BSplinesVx>(vx_min, vx_max, vx_size);
+
+    ddc::init_discrete_space<IDimX>(SplineInterpPointsX::get_sampling());
+    ddc::init_discrete_space<IDimVx>(SplineInterpPointsVx::get_sampling());
+
+    FieldSp<int> charges(dom_sp);
+    charges(my_ielec) = -1;
+    charges(my_iion) = 1;
+    DFieldSp masses(dom_sp);
+    masses(my_ielec) = 1.;
+    masses(my_iion) = 4.;
+    FieldSp<int> init_perturb_mode(dom_sp);
+    ddc::fill(init_perturb_mode, 0);
+    DFieldSp init_perturb_amplitude(dom_sp);
+    ddc::fill(init_perturb_amplitude, 0);
+
+    ddc::init_discrete_space<IDimSp>(
+            std::move(charges),
+            std::move(masses),
+            std::move(init_perturb_amplitude),
+            std::move(init_perturb_mode));
+
+    IDomainX const gridx(SplineInterpPointsX::get_domain());
+    IDomainVx const gridvx(SplineInterpPointsVx::get_domain());
+    IDomainSpXVx const mesh(dom_sp, gridx, gridvx);
+
+    SplineXBuilder const builder_x(gridx);
+    ConstantExtrapolationBoundaryValue<BSplinesX> const bv_x_min(x_min);
+    ConstantExtrapolationBoundaryValue<BSplinesX> const bv_x_max(x_max);
+    SplineEvaluator<BSplinesX> const spline_x_evaluator(bv_x_min, bv_x_max);
+    PreallocatableSplineInterpolator<IDimX, BSplinesX, SplineXBoundary, SplineXBoundary> const
+            spline_x_interpolator(builder_x, spline_x_evaluator);
+
+    BslAdvectionSpatial<GeometryXVx, IDimX> const advection_x(spline_x_interpolator);
+    BslConstantShiftAdvectionSpatial<GeometryXVx, IDimX, BSplinesX> const shift_advection_x(
+            builder_x);
+
+    DFieldSpXVx allfdistribu(mesh);
+    ddc::for_each(mesh, [&](IndexSpXVx const ispxvx) {
+        double const x = ddc::coordinate(ddc::select<IDimX>(ispxvx));
+        double const vx = ddc::coordinate(ddc::select<IDimVx>(ispxvx));
+        allfdistribu(ispxvx) = (1. + 0.1 * std::cos(x)) * std::exp(-vx * vx / 2.);
+    });
+    DFieldSpXVx allfdistribu_shift(mesh);
+    ddc::deepcopy(allfdistribu_shift, allfdistribu);
+
+    // The second step reuses the operator of the first one, the third one recomputes it
+    for (double const dt : {0.1, 0.1, 0.37}) {
+        advection_x(allfdistribu, dt);
+        shift_advection_x(allfdistribu_shift, dt);
+
+        ddc::for_each(mesh, [&](IndexSpXVx const ispxvx) {
+            EXPECT_NEAR(allfdistribu_shift(ispxvx), allfdistribu(ispxvx), 1.e-12);
+        });
+    }
+}
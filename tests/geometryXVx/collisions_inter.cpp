@@ -154,3 +154,128 @@ TEST(CollisionsInter, CollisionsInter)
     PC_tree_destroy(&conf_pdi);
     PDI_finalize();
 }
+
+/**
+ * The inter species collisions exchange momentum and energy between the species at each point
+ * of the spatial grid, which is cut in blocks treated in parallel. Each species keeps its
+ * density and the total momentum and kinetic energy of the two species are conserved at each
+ * point.
+ */
+TEST(CollisionsInter, Conservation)
+{
+    CoordX const x_min(0.0);
+    CoordX const x_max(1.0);
+    IVectX const x_size(16);
+
+    CoordVx const vx_min(-10);
+    CoordVx const vx_max(10);
+    IVectVx const vx_size(600);
+
+    IVectSp const nb_kinspecies(2);
+
+    IDomainSp const dom_sp(IndexSp(0), nb_kinspecies);
+    IndexSp const my_iion = dom_sp.front();
+    IndexSp const my_ielec = dom_sp.back();
+
+    PC_tree_t conf_pdi = PC_parse_string("");
+    PDI_init(conf_pdi);
+
+    // Creating mesh & supports
+    ddc::init_discrete_space<BSplinesX>(x_min, x_max, x_size);
+
+    ddc::init_discrete_space<BSplinesVx>(vx_min, vx_max, vx_size);
+
+    ddc::init_discrete_space<IDimX>(SplineInterpPointsX::get_sampling());
+    ddc::init_discrete_space<IDimVx>(SplineInterpPointsVx::get_sampling());
+
+    IDomainX const gridx(SplineInterpPointsX::get_domain());
+    IDomainVx const gridvx(SplineInterpPointsVx::get_domain());
+    IDomainSpXVx const mesh(dom_sp, gridx, gridvx);
+
+    FieldSp<int> charges(dom_sp);
+    charges(my_ielec) = -1;
+    charges(my_iion) = 1;
+    DFieldSp masses(dom_sp);
+    masses(my_ielec) = 1.;
+    masses(my_iion) = 400.;
+    FieldSp<int> init_perturb_mode(dom_sp);
+    ddc::fill(init_perturb_mode, 0);
+    DFieldSp init_perturb_amplitude(dom_sp);
+    ddc::fill(init_perturb_amplitude, 0);
+
+    ddc::init_discrete_space<IDimSp>(
+            std::move(charges),
+            std::move(masses),
+            std::move(init_perturb_amplitude),
+            std::move(init_perturb_mode));
+
+    // drifting maxwellians whose density, mean velocity and temperature depend on x
+    DFieldSpXVx allfdistribu(mesh);
+    ddc::for_each(ddc::get_domain<IDimSp, IDimX>(allfdistribu), [&](IndexSpX const ispx) {
+        double const x = ddc::coordinate(ddc::select<IDimX>(ispx));
+        bool const is_elec = ddc::select<IDimSp>(ispx) == my_ielec;
+        MaxwellianEquilibrium::compute_maxwellian(
+                allfdistribu[ispx],
+                1. + 0.2 * std::cos(2. * M_PI * x),
+                is_elec ? 1.2 + 0.1 * std::sin(2. * M_PI * x) : 1.,
+                is_elec ? 0.3 : -0.1 + 0.1 * std::sin(2. * M_PI * x));
+    });
+
+    DFieldVx const quadrature_coeffs = trapezoid_quadrature_coefficients(gridvx);
+    // the density, the momentum and the kinetic energy of each species at each point
+    auto const compute_moments = [&](DFieldSpX& density, DFieldSpX& momentum, DFieldSpX& energy) {
+        ddc::for_each(ddc::get_domain<IDimSp, IDimX>(allfdistribu), [&](IndexSpX const ispx) {
+            double const sqrt_mass = std::sqrt(mass(ddc::select<IDimSp>(ispx)));
+            density(ispx) = 0.;
+            momentum(ispx) = 0.;
+            energy(ispx) = 0.;
+            for (IndexVx const ivx : gridvx) {
+                double const coordv = ddc::coordinate(ivx);
+                double const weighted_f = quadrature_coeffs(ivx) * allfdistribu(ispx, ivx);
+                density(ispx) += weighted_f;
+                momentum(ispx) += sqrt_mass * coordv * weighted_f;
+                energy(ispx) += 0.5 * coordv * coordv * weighted_f;
+            }
+        });
+    };
+
+    DFieldSpX density_init(ddc::get_domain<IDimSp, IDimX>(allfdistribu));
+    DFieldSpX momentum_init(ddc::get_domain<IDimSp, IDimX>(allfdistribu));
+    DFieldSpX energy_init(ddc::get_domain<IDimSp, IDimX>(allfdistribu));
+    compute_moments(density_init, momentum_init, energy_init);
+
+    double const nustar0(0.1);
+    double const deltat(0.1);
+    CollisionsInter const collisions(mesh, nustar0);
+    int const nbiter(10);
+    for (int iter(0); iter < nbiter; iter++) {
+        collisions(allfdistribu, deltat);
+    }
+
+    DFieldSpX density(ddc::get_domain<IDimSp, IDimX>(allfdistribu));
+    DFieldSpX momentum(ddc::get_domain<IDimSp, IDimX>(allfdistribu));
+    DFieldSpX energy(ddc::get_domain<IDimSp, IDimX>(allfdistribu));
+    compute_moments(density, momentum, energy);
+
+    double const tolerance = 1.e-10;
+    ddc::for_each(gridx, [&](IndexX const ix) {
+        double total_momentum_init = 0.;
+        double total_momentum = 0.;
+        double total_energy_init = 0.;
+        double total_energy = 0.;
+        for (IndexSp const isp : dom_sp) {
+            EXPECT_NEAR(density(isp, ix), density_init(isp, ix), tolerance);
+            total_momentum_init += momentum_init(isp, ix);
+            total_momentum += momentum(isp, ix);
+            total_energy_init += energy_init(isp, ix);
+            total_energy += energy(isp, ix);
+        }
+        EXPECT_NEAR(total_momentum, total_momentum_init, tolerance);
+        EXPECT_NEAR(total_energy, total_energy_init, tolerance);
+        // the species did exchange momentum
+        EXPECT_GE(std::fabs(momentum(my_ielec, ix) - momentum_init(my_ielec, ix)), 1.e-3);
+    });
+
+    PC_tree_destroy(&conf_pdi);
+    PDI_finalize();
+}
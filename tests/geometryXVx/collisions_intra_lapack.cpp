@@ -0,0 +1,330 @@
+// SPDX-License-Identifier: MIT
+#define _USE_MATH_DEFINES
+
+#include <cmath>
+
+#include <ddc/ddc.hpp>
+
+#include <sll/matrix_banded.hpp>
+
+#include <gtest/gtest.h>
+
+#include <collisions_intra.hpp>
+#include <collisions_utils.hpp>
+#include <fluid_moments.hpp>
+#include <geometry.hpp>
+#include <maxwellianequilibrium.hpp>
+#include <paraconf.h>
+#include <pdi.h>
+#include <quadrature.hpp>
+#include <species_info.hpp>
+#include <trapezoid_quadrature.hpp>
+
+#include "collisions_reference.hpp"
+
+namespace {
+
+using IDimVxGhosted = CollisionsIntra::ghosted_vx_point_sampling;
+using IDimVxGhostedStaggered = CollisionsIntra::ghosted_vx_staggered_point_sampling;
+using IndexVxGhosted = CollisionsIntra::IndexVx_ghosted;
+using IndexVxGhostedStaggered = CollisionsIntra::IndexVx_ghosted_staggered;
+
+/**
+ * Applies the intra species collisions by assembling the tridiagonal matrix of each
+ * (species, x) line and solving it with the LU factorisation with partial pivoting of LAPACK.
+ * This is the implementation used before the systems were solved line by line with the
+ * Thomas algorithm.
+ */
+void collisions_intra_lapack(
+        CollisionsIntra const& collisions,
+        DSpanSpXVx const allfdistribu,
+        double const nustar0,
+        double const dt)
+{
+    IDomainSpX const dom_spx = ddc::get_domain<IDimSp, IDimX>(allfdistribu);
+    IDomainVx const gridvx = ddc::get_domain<IDimVx>(allfdistribu);
+    CollisionsIntra::IDomainSpXVx_ghosted const mesh_ghosted(
+            ddc::select<IDimSp>(dom_spx),
+            ddc::select<IDimX>(dom_spx),
+            collisions.get_gridvx_ghosted());
+    CollisionsIntra::IDomainSpXVx_ghosted_staggered const mesh_ghosted_staggered(
+            ddc::select<IDimSp>(dom_spx),
+            ddc::select<IDimX>(dom_spx),
+            collisions.get_gridvx_ghosted_staggered());
+    double const fthresh = 1.e-30;
+
+    // density and temperature
+    DFieldSpX density(dom_spx);
+    DFieldSpX mean_velocity(dom_spx);
+    DFieldSpX temperature(dom_spx);
+    FluidMoments moments(Quadrature<IDimVx>(trapezoid_quadrature_coefficients(gridvx)));
+    moments(density.span_view(), allfdistribu.span_cview(), FluidMoments::s_density);
+    moments(mean_velocity.span_view(),
+            allfdistribu.span_cview(),
+            density.span_cview(),
+            FluidMoments::s_velocity);
+    moments(temperature.span_view(),
+            allfdistribu.span_cview(),
+            density.span_cview(),
+            mean_velocity.span_cview(),
+            FluidMoments::s_temperature);
+
+    // collision frequency
+    DFieldSpX nustar_profile(dom_spx);
+    compute_nustar_profile(nustar_profile.span_view(), nustar0);
+    DFieldSpX collfreq(dom_spx);
+    compute_collfreq(
+            collfreq.span_view(),
+            nustar_profile.span_cview(),
+            density.span_cview(),
+            temperature.span_cview());
+
+    // diffusion coefficient
+    ddc::Chunk<double, CollisionsIntra::IDomainSpXVx_ghosted> Dcoll(mesh_ghosted);
+    compute_Dcoll<IDimVxGhosted>(
+            Dcoll.span_view(),
+            collfreq.span_cview(),
+            density.span_cview(),
+            temperature.span_cview());
+    ddc::Chunk<double, CollisionsIntra::IDomainSpXVx_ghosted> dvDcoll(mesh_ghosted);
+    compute_dvDcoll<IDimVxGhosted>(
+            dvDcoll.span_view(),
+            collfreq.span_cview(),
+            density.span_cview(),
+            temperature.span_cview());
+    ddc::Chunk<double, CollisionsIntra::IDomainSpXVx_ghosted_staggered> Dcoll_staggered(
+            mesh_ghosted_staggered);
+    compute_Dcoll<IDimVxGhostedStaggered>(
+            Dcoll_staggered.span_view(),
+            collfreq.span_cview(),
+            density.span_cview(),
+            temperature.span_cview());
+
+    // kernel maxwellian fluid moments
+    DFieldSpX Vcoll(dom_spx);
+    DFieldSpX Tcoll(dom_spx);
+    compute_Vcoll_Tcoll<IDimVxGhosted>(
+            Vcoll.span_view(),
+            Tcoll.span_view(),
+            allfdistribu.span_cview(),
+            Dcoll.span_cview(),
+            dvDcoll.span_cview());
+
+    // convection coefficient Nucoll
+    ddc::Chunk<double, CollisionsIntra::IDomainSpXVx_ghosted> Nucoll(mesh_ghosted);
+    compute_Nucoll<IDimVxGhosted>(
+            Nucoll.span_view(),
+            Dcoll.span_cview(),
+            Vcoll.span_cview(),
+            Tcoll.span_cview());
+
+    int const npoints = gridvx.size();
+    ddc::for_each(dom_spx, [&](IndexSpX const ispx) {
+        DFieldVx rhs(gridvx);
+        Matrix_Banded matrix(npoints, 1, 1);
+        for (IndexVx const ivx : gridvx) {
+            IndexVxGhosted const ivx_ghosted(ivx.uid() + 1);
+            IndexVxGhostedStaggered const ivx_ghosted_staggered(ivx.uid() + 1);
+            IndexVxGhosted const ivx_next_ghosted(ivx_ghosted + 1);
+            IndexVxGhosted const ivx_prev_ghosted(ivx_ghosted - 1);
+            IndexVxGhostedStaggered const ivx_prev_ghosted_staggered(ivx_ghosted_staggered - 1);
+
+            double const dv_i
+                    = ddc::coordinate(ivx_next_ghosted) - ddc::coordinate(ivx_ghosted);
+            double const delta_i
+                    = dv_i / (ddc::coordinate(ivx_ghosted) - ddc::coordinate(ivx_prev_ghosted));
+
+            double const alpha_i = dt / (dv_i * dv_i * (1. + delta_i));
+            double const beta_i = dt / (2. * dv_i * (1. + delta_i));
+
+            double const Dcoll_i = Dcoll(ispx, ivx_ghosted);
+            double const Dcoll_staggered_i = Dcoll_staggered(ispx, ivx_ghosted_staggered);
+            double const Dcoll_staggered_prev
+                    = Dcoll_staggered(ispx, ivx_prev_ghosted_staggered);
+
+            double const coeffa = alpha_i
+                                          * (Dcoll_staggered_prev * delta_i * delta_i * delta_i
+                                             - Dcoll_i * delta_i * delta_i * (delta_i - 1.))
+                                  + beta_i * Nucoll(ispx, ivx_prev_ghosted) * delta_i * delta_i;
+            double const coeffb
+                    = -alpha_i
+                              * (-Dcoll_staggered_i
+                                 - Dcoll_staggered_prev * delta_i * delta_i * delta_i
+                                 + Dcoll_i * (delta_i - 1.) * (delta_i * delta_i - 1.))
+                      + beta_i * Nucoll(ispx, ivx_ghosted) * (delta_i * delta_i - 1.);
+            double const coeffc = alpha_i * (Dcoll_staggered_i + Dcoll_i * (delta_i - 1.))
+                                  - beta_i * Nucoll(ispx, ivx_next_ghosted);
+
+            double const aa = -coeffa;
+            double const bb = 1. + coeffb;
+            double const cc = -coeffc;
+
+            int const i = (ivx - gridvx.front()).value();
+            matrix.set_element(i, i, bb);
+            rhs(ivx) = (2. - bb) * allfdistribu(ispx, ivx);
+            if (ivx == gridvx.front()) {
+                matrix.set_element(i, i + 1, cc);
+                rhs(ivx) += -cc * allfdistribu(ispx, ivx + 1) - 2. * aa * fthresh;
+            } else if (ivx == gridvx.back()) {
+                matrix.set_element(i, i - 1, aa);
+                rhs(ivx) += -aa * allfdistribu(ispx, ivx - 1) - 2. * cc * fthresh;
+            } else {
+                matrix.set_element(i, i - 1, aa);
+                matrix.set_element(i, i + 1, cc);
+                rhs(ivx) += -aa * allfdistribu(ispx, ivx - 1) - cc * allfdistribu(ispx, ivx + 1);
+            }
+        }
+        matrix.factorize();
+        matrix.solve_inplace(DSpan1D(rhs.data_handle(), npoints));
+        ddc::deepcopy(allfdistribu[ispx], rhs);
+    });
+}
+
+/**
+ * Initialises the discrete spaces of an ion and an electron species on a unit box.
+ * @return The mesh of the distribution function.
+ */
+IDomainSpXVx init_discrete_spaces(
+        IVectX const x_size,
+        CoordVx const vx_max,
+        IVectVx const vx_size)
+{
+    CoordX const x_min(0.0);
+    CoordX const x_max(1.0);
+    CoordVx const vx_min(-vx_max);
+
+    IDomainSp const dom_sp(IndexSp(0), IVectSp(2));
+    IndexSp const my_iion = dom_sp.front();
+    IndexSp const my_ielec = dom_sp.back();
+
+    ddc::init_discrete_space<BSplinesX>(x_min, x_max, x_size);
+    ddc::init_discrete_space<BSplinesVx>(vx_min, vx_max, vx_size);
+
+    ddc::init_discrete_space<IDimX>(SplineInterpPointsX::get_sampling());
+    ddc::init_discrete_space<IDimVx>(SplineInterpPointsVx::get_sampling());
+
+    IDomainX const gridx(SplineInterpPointsX::get_domain());
+    IDomainVx const gridvx(SplineInterpPointsVx::get_domain());
+
+    FieldSp<int> charges(dom_sp);
+    charges(my_ielec) = -1;
+    charges(my_iion) = 1;
+    DFieldSp masses(dom_sp);
+    masses(my_ielec) = 1.;
+    masses(my_iion) = 400.;
+    FieldSp<int> init_perturb_mode(dom_sp);
+    ddc::fill(init_perturb_mode, 0);
+    DFieldSp init_perturb_amplitude(dom_sp);
+    ddc::fill(init_perturb_amplitude, 0);
+
+    ddc::init_discrete_space<IDimSp>(
+            std::move(charges),
+            std::move(masses),
+            std::move(init_perturb_amplitude),
+            std::move(init_perturb_mode));
+
+    return IDomainSpXVx(dom_sp, gridx, gridvx);
+}
+
+/**
+ * Initialises the distribution function with a maxwellian whose moments depend on x and a
+ * bump on its tail.
+ */
+void init_bump_on_tail(DSpanSpXVx const allfdistribu)
+{
+    IDomainVx const gridvx = ddc::get_domain<IDimVx>(allfdistribu);
+    DFieldVx maxwellian(gridvx);
+    DFieldVx bump(gridvx);
+    ddc::for_each(ddc::get_domain<IDimSp, IDimX>(allfdistribu), [&](IndexSpX const ispx) {
+        double const coordx = ddc::coordinate(ddc::select<IDimX>(ispx));
+        double const perturbation = std::sin(2 * M_PI * coordx);
+        MaxwellianEquilibrium::compute_maxwellian(
+                maxwellian.span_view(),
+                1. + 0.1 * perturbation,
+                1. + 0.3 * perturbation,
+                0.2 * perturbation);
+        MaxwellianEquilibrium::compute_maxwellian(bump.span_view(), 0.1, 0.5, 3.);
+        ddc::for_each(gridvx, [&](IndexVx const ivx) {
+            allfdistribu(ispx, ivx) = maxwellian(ivx) + bump(ivx);
+        });
+    });
+}
+
+double max_relative_difference(DViewSpXVx const fdistribu, DViewSpXVx const fdistribu_ref)
+{
+    double const max_ref = ddc::transform_reduce(
+            fdistribu_ref.domain(),
+            0.,
+            ddc::reducer::max<double>(),
+            [&](IndexSpXVx const ispxvx) { return std::fabs(fdistribu_ref(ispxvx)); });
+    double const max_difference = ddc::transform_reduce(
+            fdistribu.domain(),
+            0.,
+            ddc::reducer::max<double>(),
+            [&](IndexSpXVx const ispxvx) {
+                return std::fabs(fdistribu(ispxvx) - fdistribu_ref(ispxvx));
+            });
+    return max_difference / max_ref;
+}
+
+} // namespace
+
+/**
+ * With a strong collisionality, a large time step and a coarse velocity grid, the convection
+ * dominates the diffusion on the cells of the tail of the distribution function and the
+ * matrices are not diagonally dominant.
+ */
+TEST(CollisionsIntraLapack, StiffParameters)
+{
+    PC_tree_t conf_pdi = PC_parse_string("");
+    PDI_init(conf_pdi);
+
+    IDomainSpXVx const mesh = init_discrete_spaces(IVectX(4), CoordVx(12.), IVectVx(40));
+    DFieldSpXVx allfdistribu(mesh);
+    init_bump_on_tail(allfdistribu);
+
+    double const nustar0(10.);
+    double const deltat(1.);
+    CollisionsIntra const collisions(mesh, nustar0);
+
+    DFieldSpXVx allfdistribu_ref(mesh);
+    ddc::deepcopy(allfdistribu_ref, allfdistribu);
+
+    collisions(allfdistribu, deltat);
+    collisions_intra_lapack(collisions, allfdistribu_ref, nustar0, deltat);
+
+    EXPECT_LE(max_relative_difference(allfdistribu, allfdistribu_ref), 1.e-12);
+
+    PC_tree_destroy(&conf_pdi);
+    PDI_finalize();
+}
+
+/**
+ * One step of the collisions with the parameters of the simulations, where the systems are
+ * diagonally dominant and solved with the Thomas algorithm, must give the same distribution
+ * function as the previous implementation.
+ */
+TEST(CollisionsIntraLapack, OneStep)
+{
+    PC_tree_t conf_pdi = PC_parse_string("");
+    PDI_init(conf_pdi);
+
+    IDomainSpXVx const mesh = init_discrete_spaces(IVectX(5), CoordVx(10.), IVectVx(600));
+    DFieldSpXVx allfdistribu(mesh);
+    init_bump_on_tail(allfdistribu);
+
+    double const nustar0(0.1);
+    double const deltat(0.1);
+    CollisionsIntra const collisions(mesh, nustar0);
+
+    DFieldSpXVx allfdistribu_ref(mesh);
+    ddc::deepcopy(allfdistribu_ref, allfdistribu);
+
+    collisions(allfdistribu, deltat);
+    collisions_intra_lapack(collisions, allfdistribu_ref, nustar0, deltat);
+
+    EXPECT_LE(max_relative_difference(allfdistribu, allfdistribu_ref), 1.e-12);
+
+    PC_tree_destroy(&conf_pdi);
+    PDI_finalize();
+}
@@ -19,6 +19,8 @@
 #include <species_info.hpp>
 #include <trapezoid_quadrature.hpp>
 
+#include "collisions_reference.hpp"
+
 /**
  * Intra species collisions applied on a maxwellian should not change the distribution function
  */
@@ -156,20 +158,16 @@ TEST(CollisionsIntraMaxwellian, CollisionsIntraMaxwellian)
     });
 
     // diffusion coefficient
-    ddc::Chunk<
-            double,
-            ddc::DiscreteDomain<IDimSp, IDimX, CollisionsIntra::ghosted_vx_point_sampling>>
-            Dcoll(collisions.get_mesh_ghosted());
+    CollisionsIntra::IDomainSpXVx_ghosted const
+            mesh_ghosted(dom_sp, gridx, collisions.get_gridvx_ghosted());
+    ddc::Chunk<double, CollisionsIntra::IDomainSpXVx_ghosted> Dcoll(mesh_ghosted);
     compute_Dcoll<CollisionsIntra::ghosted_vx_point_sampling>(
             Dcoll.span_view(),
             collfreq.span_cview(),
             density_init.span_cview(),
             temperature_init.span_cview());
 
-    ddc::Chunk<
-            double,
-            ddc::DiscreteDomain<IDimSp, IDimX, CollisionsIntra::ghosted_vx_point_sampling>>
-            dvDcoll(collisions.get_mesh_ghosted());
+    ddc::Chunk<double, CollisionsIntra::IDomainSpXVx_ghosted> dvDcoll(mesh_ghosted);
     compute_dvDcoll<CollisionsIntra::ghosted_vx_point_sampling>(
             dvDcoll.span_view(),
             collfreq.span_cview(),
@@ -0,0 +1,122 @@
+// SPDX-License-Identifier: MIT
+
+#include <cmath>
+
+#include <ddc/ddc.hpp>
+
+#include <gtest/gtest.h>
+
+#include <paraconf.h>
+#include <pdi.h>
+
+#include "extrapolatedpredcorr.hpp"
+#include "geometry.hpp"
+#include "landau_test_case.hpp"
+#include "predcorr.hpp"
+
+TEST(ExtrapolatedPredCorr, Order)
+{
+    PC_tree_t conf_pdi = PC_parse_string("");
+    PDI_init(conf_pdi);
+
+    LandauTestCase const landau;
+    ExtrapolatedPredCorr const time_solver(landau.vlasov, landau.poisson);
+    PredCorr const predcorr(landau.vlasov, landau.poisson);
+
+    double const dt = 0.2;
+    double const final_time = 4.;
+
+    DFieldSpXVx allfdistribu_ref(landau.mesh);
+    run_landau(landau, time_solver, allfdistribu_ref, dt / 8., final_time);
+
+    DFieldSpXVx allfdistribu_coarse(landau.mesh);
+    run_landau(landau, time_solver, allfdistribu_coarse, dt, final_time);
+    DFieldSpXVx allfdistribu_fine(landau.mesh);
+    run_landau(landau, time_solver, allfdistribu_fine, dt / 2., final_time);
+
+    double const observed_order = std::log2(
+            max_difference(allfdistribu_coarse, allfdistribu_ref)
+            / max_difference(allfdistribu_fine, allfdistribu_ref));
+    EXPECT_GE(observed_order, 1.5);
+
+    // both schemes are second order so their difference decreases at second order too
+    DFieldSpXVx allfdistribu_predcorr_coarse(landau.mesh);
+    run_landau(landau, predcorr, allfdistribu_predcorr_coarse, dt, final_time);
+    DFieldSpXVx allfdistribu_predcorr_fine(landau.mesh);
+    run_landau(landau, predcorr, allfdistribu_predcorr_fine, dt / 2., final_time);
+
+    double const difference_coarse
+            = max_difference(allfdistribu_coarse, allfdistribu_predcorr_coarse);
+    double const difference_fine = max_difference(allfdistribu_fine, allfdistribu_predcorr_fine);
+    EXPECT_LE(difference_fine, 1.e-3);
+    EXPECT_GE(std::log2(difference_coarse / difference_fine), 1.5);
+
+    PC_tree_destroy(&conf_pdi);
+    PDI_finalize();
+}
+
+TEST(ExtrapolatedPredCorr, Restart)
+{
+    PC_tree_t conf_pdi = PC_parse_string("");
+    PDI_init(conf_pdi);
+
+    LandauTestCase const landau;
+    ExtrapolatedPredCorr const time_solver(landau.vlasov, landau.poisson);
+
+    double const dt = 0.1;
+    int const nbiter = 8;
+    int const iter_restart = 4;
+
+    DFieldSpXVx allfdistribu(landau.mesh);
+    landau.initialize(allfdistribu);
+    time_solver(allfdistribu, dt, nbiter);
+
+    // the checkpoint of iter_restart holds the distribution function and the field of the
+    // previous iteration
+    DFieldSpXVx allfdistribu_restart(landau.mesh);
+    landau.initialize(allfdistribu_restart);
+    time_solver(allfdistribu_restart, dt, iter_restart - 1);
+    IDomainX const gridx = ddc::select<IDimX>(landau.mesh);
+    DFieldX electrostatic_potential(gridx);
+    DFieldX electric_field_prev(gridx);
+    landau.poisson(electrostatic_potential, electric_field_prev, allfdistribu_restart);
+    time_solver(allfdistribu_restart, dt, 1, iter_restart - 1);
+
+    // a new run restarted from the checkpoint takes the same steps
+    ExtrapolatedPredCorr const restarted_time_solver(landau.vlasov, landau.poisson);
+    restarted_time_solver.set_history(iter_restart, dt, electric_field_prev);
+    restarted_time_solver(allfdistribu_restart, dt, nbiter - iter_restart, iter_restart);
+
+    EXPECT_EQ(max_difference(allfdistribu_restart, allfdistribu), 0.);
+
+    PC_tree_destroy(&conf_pdi);
+    PDI_finalize();
+}
+
+TEST(PredCorr, Restart)
+{
+    PC_tree_t conf_pdi = PC_parse_string("");
+    PDI_init(conf_pdi);
+
+    LandauTestCase const landau;
+    PredCorr const time_solver(landau.vlasov, landau.poisson);
+
+    double const dt = 0.1;
+    int const nbiter = 8;
+    int const iter_restart = 4;
+
+    DFieldSpXVx allfdistribu(landau.mesh);
+    landau.initialize(allfdistribu);
+    time_solver(allfdistribu, dt, nbiter);
+
+    DFieldSpXVx allfdistribu_restart(landau.mesh);
+    landau.initialize(allfdistribu_restart);
+    time_solver(allfdistribu_restart, dt, iter_restart);
+    time_solver(allfdistribu_restart, dt, nbiter - iter_restart, iter_restart);
+
+    // the scheme is one step so the restart is exact
+    EXPECT_EQ(max_difference(allfdistribu_restart, allfdistribu), 0.);
+
+    PC_tree_destroy(&conf_pdi);
+    PDI_finalize();
+}
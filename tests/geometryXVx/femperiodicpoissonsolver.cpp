@@ -14,6 +14,7 @@
 
 #include "femperiodicpoissonsolver.hpp"
 #include "geometry.hpp"
+#include "poisson_weak_form.hpp"
 #include "species_info.hpp"
 
 TEST(FemPeriodicPoissonSolver, CosineSource)
@@ -54,9 +55,6 @@ TEST(FemPeriodicPoissonSolver, CosineSource)
     SplineEvaluator<BSplinesX> const
             spline_x_evaluator(g_null_boundary<BSplinesX>, g_null_boundary<BSplinesX>);
 
-    SplineEvaluator<BSplinesVx> const
-            spline_vx_evaluator(g_null_boundary<BSplinesVx>, g_null_boundary<BSplinesVx>);
-
     FieldSp<int> charges(dom_sp);
     charges(my_ielec) = -1;
     charges(my_iion) = 1;
@@ -74,8 +72,7 @@ TEST(FemPeriodicPoissonSolver, CosineSource)
             std::move(init_perturb_amplitude),
             std::move(init_perturb_mode));
 
-    FemPeriodicPoissonSolver
-            poisson(builder_x, spline_x_evaluator, builder_vx, spline_vx_evaluator);
+    FemPeriodicPoissonSolver poisson(builder_x, spline_x_evaluator, builder_vx);
 
     DFieldX electrostatic_potential(gridx);
     DFieldX electric_field(gridx);
@@ -104,4 +101,17 @@ TEST(FemPeriodicPoissonSolver, CosineSource)
     }
     EXPECT_LE(error_pot, 1e-8);
     EXPECT_LE(error_field, 1e-6);
+
+    // The systems assembled from the cached B-spline values are those of the quadrature of
+    // the weak form at the Gauss points
+    DFieldX rho(gridx);
+    ddc::for_each(gridx, [&](IndexX const ix) { rho(ix) = cos(ddc::coordinate(ix)); });
+    double const residual = poisson_weak_form_residual(
+            electrostatic_potential,
+            rho,
+            builder_x,
+            spline_x_evaluator,
+            0,
+            ddc::discrete_space<BSplinesX>().nbasis());
+    EXPECT_LE(residual, 1e-12);
 }
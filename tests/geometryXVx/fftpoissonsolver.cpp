@@ -0,0 +1,99 @@
+// SPDX-License-Identifier: MIT
+
+#include <cmath>
+
+#include <ddc/ddc.hpp>
+
+#include <sll/null_boundary_value.hpp>
+#include <sll/spline_builder.hpp>
+#include <sll/spline_evaluator.hpp>
+
+#include <gtest/gtest.h>
+
+#include "fftpoissonsolver.hpp"
+#include "geometry.hpp"
+#include "species_info.hpp"
+
+/**
+ * The spectral electric field of a single Fourier mode of the charge density is exact up to
+ * round-off errors.
+ */
+TEST(FftPoissonSolver, SpectralElectricField)
+{
+    CoordX const x_min(0.0);
+    CoordX const x_max(2.0 * M_PI);
+    IVectX const x_size(32);
+
+    CoordVx const vx_min(-0.5);
+    CoordVx const vx_max(0.5);
+    IVectVx const vx_size(10);
+
+    IVectSp const nb_species(2);
+    IDomainSp const dom_sp(IndexSp(0), nb_species);
+    IndexSp const my_ielec = dom_sp.front();
+    IndexSp const my_iion = dom_sp.back();
+
+    // Creating mesh & supports
+    ddc::init_discrete_space<BSplinesX>(x_min, x_max, x_size);
+
+    ddc::init_discrete_space<BSplinesVx>(vx_min, vx_max, vx_size);
+
+    ddc::init_discrete_space<IDimX>(SplineInterpPointsX::get_sampling());
+    ddc::init_discrete_space<IDimVx>(SplineInterpPointsVx::get_sampling());
+    ddc::DiscreteDomain<IDimX> interpolation_domain_x(SplineInterpPointsX::get_domain());
+    ddc::DiscreteDomain<IDimVx> interpolation_domain_vx(SplineInterpPointsVx::get_domain());
+
+    SplineXBuilder const builder_x(interpolation_domain_x);
+
+    SplineVxBuilder const builder_vx(interpolation_domain_vx);
+
+    IDomainX const gridx = builder_x.interpolation_domain();
+    IDomainVx const gridvx = builder_vx.interpolation_domain();
+    IDomainSp const gridsp = IDomainSp(my_iion, IVectSp(1));
+
+    IDomainSpXVx const mesh(gridsp, gridx, gridvx);
+
+    SplineEvaluator<BSplinesX> const
+            spline_x_evaluator(g_null_boundary<BSplinesX>, g_null_boundary<BSplinesX>);
+
+    FieldSp<int> charges(dom_sp);
+    charges(my_ielec) = -1;
+    charges(my_iion) = 1;
+    DFieldSp masses(dom_sp);
+    ddc::fill(masses, 1);
+    FieldSp<int> init_perturb_mode(dom_sp);
+    ddc::fill(init_perturb_mode, 0);
+    DFieldSp init_perturb_amplitude(dom_sp);
+    ddc::fill(init_perturb_amplitude, 0);
+
+    ddc::init_discrete_space<IDimSp>(
+            std::move(charges),
+            std::move(masses),
+            std::move(init_perturb_amplitude),
+            std::move(init_perturb_mode));
+
+    FftPoissonSolver const poisson(builder_x, spline_x_evaluator, builder_vx, true);
+
+    DFieldX electrostatic_potential(gridx);
+    DFieldX electric_field(gridx);
+    DFieldSpXVx allfdistribu(mesh);
+
+    // The charge density is cos(2x) so Phi = cos(2x) / 4 and E = sin(2x) / 2
+    ddc::for_each(mesh, [&](IndexSpXVx const ispxvx) {
+        allfdistribu(ispxvx) = std::cos(2. * ddc::coordinate(ddc::select<IDimX>(ispxvx)));
+    });
+
+    poisson(electrostatic_potential, electric_field, allfdistribu);
+
+    double error_pot = 0.0;
+    double error_field = 0.0;
+    for (IndexX const ix : gridx) {
+        double const x = ddc::coordinate(ix);
+        error_pot = std::fmax(
+                std::fabs(electrostatic_potential(ix) - std::cos(2. * x) / 4.),
+                error_pot);
+        error_field = std::fmax(std::fabs(electric_field(ix) - std::sin(2. * x) / 2.), error_field);
+    }
+    EXPECT_LE(error_pot, 1e-12);
+    EXPECT_LE(error_field, 1e-12);
+}
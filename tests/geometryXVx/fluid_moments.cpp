@@ -125,4 +125,24 @@ TEST(Physics, FluidMoments)
         EXPECT_LE(std::fabs(mean_velocity_computed(ispx) - mean_velocity_init(ispx)), 1e-12);
         EXPECT_LE(std::fabs(temperature_computed(ispx) - temperature_init(ispx)), 1e-12);
     });
+
+    // all the moments at once
+    DFieldSpX density_all(ddc::get_domain<IDimSp, IDimX>(allfdistribu));
+    DFieldSpX mean_velocity_all(ddc::get_domain<IDimSp, IDimX>(allfdistribu));
+    DFieldSpX temperature_all(ddc::get_domain<IDimSp, IDimX>(allfdistribu));
+    DFieldSpX heat_flux_all(ddc::get_domain<IDimSp, IDimX>(allfdistribu));
+    moments(density_all.span_view(),
+            mean_velocity_all.span_view(),
+            temperature_all.span_view(),
+            heat_flux_all.span_view(),
+            allfdistribu.span_cview(),
+            FluidMoments::s_all);
+
+    ddc::for_each(ddc::get_domain<IDimSp, IDimX>(allfdistribu), [&](IndexSpX const ispx) {
+        EXPECT_LE(std::fabs(density_all(ispx) - density_init(ispx)), 1e-12);
+        EXPECT_LE(std::fabs(mean_velocity_all(ispx) - mean_velocity_init(ispx)), 1e-12);
+        EXPECT_LE(std::fabs(temperature_all(ispx) - temperature_init(ispx)), 1e-12);
+        // the heat flux of a Maxwellian vanishes
+        EXPECT_LE(std::fabs(heat_flux_all(ispx)), 1e-12);
+    });
 }
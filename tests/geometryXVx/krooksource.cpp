@@ -118,53 +118,37 @@ TEST(KrookSource, Adaptive)
         }
     });
 
-    // error with a given deltat
-    double const deltat = 0.1;
-    rhs_krook(allfdistribu, deltat);
-
-    DFieldSpX densities(ddc::get_domain<IDimSp, IDimX>(allfdistribu));
-    ddc::for_each(ddc::get_domain<IDimSp, IDimX>(allfdistribu), [&](IndexSpX const ispx) {
-        densities(ispx) = integrate_v(allfdistribu[ispx]);
-    });
+    DFieldVx ftarget(gridvx);
+    MaxwellianEquilibrium::compute_maxwellian(ftarget, density_target, temperature_target, 0.);
+    double const density_target_discrete = integrate_v(ftarget.span_cview());
 
-    // the charge should be conserved by the operator
-    DFieldX error(ddc::get_domain<IDimX>(allfdistribu));
-    ddc::for_each(ddc::get_domain<IDimX>(allfdistribu), [&](IndexX const ix) {
-        error(ix) = std::fabs(
-                charge(my_iion) * (densities(my_iion, ix) - density_init_ion)
-                + charge(my_ielec) * (densities(my_ielec, ix) - density_init_elec));
-    });
+    // compute the krook mask (spatial extent)
+    DFieldX mask = mask_tanh(gridx, extent, stiffness, MaskType::Inverted, false);
 
-    // reinitialization of the distribution function
-    ddc::for_each(ddc::get_domain<IDimSp, IDimX>(allfdistribu), [&](IndexSpX const ispx) {
-        DFieldVx finit(gridvx);
-        if (charge(ddc::select<IDimSp>(ispx)) >= 0.) {
-            MaxwellianEquilibrium::
-                    compute_maxwellian(finit, density_init_ion, temperature_init, 0.);
-            ddc::deepcopy(allfdistribu[ispx], finit);
-        } else {
-            MaxwellianEquilibrium::
-                    compute_maxwellian(finit, density_init_elec, temperature_init, 0.);
-            ddc::deepcopy(allfdistribu[ispx], finit);
-        }
-    });
+    double const deltat = 0.1;
+    int const nbsteps = 10;
+    for (int iter = 0; iter < nbsteps; ++iter) {
+        rhs_krook(allfdistribu, deltat);
+    };
 
-    // error with a deltat 10 times smaller
-    rhs_krook(allfdistribu, 0.01);
+    DFieldSpX densities(ddc::get_domain<IDimSp, IDimX>(allfdistribu));
     ddc::for_each(ddc::get_domain<IDimSp, IDimX>(allfdistribu), [&](IndexSpX const ispx) {
         densities(ispx) = integrate_v(allfdistribu[ispx]);
     });
 
-    // the rk2 scheme used in the krook operator should be of order 2
-    // hence the error should be divided by at least 100 when dt is divided by 10
-    double const order = 2;
     ddc::for_each(ddc::get_domain<IDimX>(allfdistribu), [&](IndexX const ix) {
-        double const error_smalldt = std::fabs(
+        // the charge should be conserved by the operator
+        double const error_charge = std::fabs(
                 charge(my_iion) * (densities(my_iion, ix) - density_init_ion)
                 + charge(my_ielec) * (densities(my_ielec, ix) - density_init_elec));
-        std::cout << "ix " << ix << "error " << error(ix) << " error_smalldt " << error_smalldt
-                  << std::endl;
-        EXPECT_LE(error_smalldt, error(ix) / std::pow(10, order));
+        EXPECT_LE(error_charge, 1e-13);
+
+        // the ions should relax exponentially towards the target
+        double const density_ion_pred
+                = density_target_discrete
+                  + (density_init_ion - density_target_discrete)
+                            * std::exp(-amplitude * mask(ix) * deltat * nbsteps);
+        EXPECT_LE(std::fabs(densities(my_iion, ix) - density_ion_pred), 1e-13);
     });
 
     PC_tree_destroy(&conf_pdi);
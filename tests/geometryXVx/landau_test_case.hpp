@@ -0,0 +1,201 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cmath>
+
+#include <ddc/ddc.hpp>
+
+#include <sll/constant_extrapolation_boundary_value.hpp>
+#include <sll/spline_evaluator.hpp>
+
+#include <bsl_advection_vx.hpp>
+#include <bsl_advection_x.hpp>
+#include <femperiodicpoissonsolver.hpp>
+#include <geometry.hpp>
+#include <itimesolver.hpp>
+#include <maxwellianequilibrium.hpp>
+#include <singlemodeperturbinitialization.hpp>
+#include <species_info.hpp>
+#include <spline_interpolator.hpp>
+#include <splitvlasovsolver.hpp>
+
+/**
+ * @brief The mesh and the operators of a small Landau damping case with kinetic electrons and
+ * adiabatic ions, used to compare the time solvers.
+ *
+ * The discrete spaces are initialised when the case is created, so a case must not be used once
+ * another test has initialised them again.
+ */
+class LandauTestCase
+{
+public:
+    using PreallocatableSplineInterpolatorX
+            = PreallocatableSplineInterpolator<IDimX, BSplinesX, SplineXBoundary, SplineXBoundary>;
+    using PreallocatableSplineInterpolatorVx = PreallocatableSplineInterpolator<
+            IDimVx,
+            BSplinesVx,
+            BoundCond::HERMITE,
+            BoundCond::HERMITE>;
+
+private:
+    // Initialises the discrete spaces before the operators using them are constructed
+    struct DiscreteSpaces
+    {
+        DiscreteSpaces(
+                CoordX const x_min,
+                CoordX const x_max,
+                CoordVx const vx_min,
+                CoordVx const vx_max)
+        {
+            ddc::init_discrete_space<BSplinesX>(x_min, x_max, IVectX(64));
+            ddc::init_discrete_space<BSplinesVx>(vx_min, vx_max, IVectVx(128));
+
+            ddc::init_discrete_space<IDimX>(SplineInterpPointsX::get_sampling());
+            ddc::init_discrete_space<IDimVx>(SplineInterpPointsVx::get_sampling());
+
+            // kinetic electrons and adiabatic ions
+            IDomainSp const dom_allsp(IndexSp(0), IVectSp(2));
+            FieldSp<int> charges(dom_allsp);
+            charges(dom_allsp.front()) = -1;
+            charges(dom_allsp.back()) = 1;
+            DFieldSp masses(dom_allsp);
+            ddc::fill(masses, 1.);
+            FieldSp<int> init_perturb_mode(dom_allsp);
+            ddc::fill(init_perturb_mode, 1);
+            DFieldSp init_perturb_amplitude(dom_allsp);
+            ddc::fill(init_perturb_amplitude, 0.05);
+
+            ddc::init_discrete_space<IDimSp>(
+                    std::move(charges),
+                    std::move(masses),
+                    std::move(init_perturb_amplitude),
+                    std::move(init_perturb_mode));
+        }
+    };
+
+    CoordX const m_x_min = CoordX(0.);
+    CoordX const m_x_max = CoordX(4. * M_PI);
+    CoordVx const m_vx_min = CoordVx(-6.);
+    CoordVx const m_vx_max = CoordVx(6.);
+
+    DiscreteSpaces const m_discrete_spaces
+            = DiscreteSpaces(m_x_min, m_x_max, m_vx_min, m_vx_max);
+
+    ConstantExtrapolationBoundaryValue<BSplinesX> const m_bv_x_min
+            = ConstantExtrapolationBoundaryValue<BSplinesX>(m_x_min);
+    ConstantExtrapolationBoundaryValue<BSplinesX> const m_bv_x_max
+            = ConstantExtrapolationBoundaryValue<BSplinesX>(m_x_max);
+    ConstantExtrapolationBoundaryValue<BSplinesVx> const m_bv_vx_min
+            = ConstantExtrapolationBoundaryValue<BSplinesVx>(m_vx_min);
+    ConstantExtrapolationBoundaryValue<BSplinesVx> const m_bv_vx_max
+            = ConstantExtrapolationBoundaryValue<BSplinesVx>(m_vx_max);
+
+public:
+    IDomainSpXVx const mesh = IDomainSpXVx(
+            IDomainSp(IndexSp(0), IVectSp(1)),
+            SplineInterpPointsX::get_domain(),
+            SplineInterpPointsVx::get_domain());
+
+    SplineXBuilder const builder_x = SplineXBuilder(ddc::select<IDimX>(mesh));
+
+    SplineVxBuilder const builder_vx = SplineVxBuilder(ddc::select<IDimVx>(mesh));
+
+    SplineEvaluator<BSplinesX> const spline_x_evaluator
+            = SplineEvaluator<BSplinesX>(m_bv_x_min, m_bv_x_max);
+
+    SplineEvaluator<BSplinesVx> const spline_vx_evaluator
+            = SplineEvaluator<BSplinesVx>(m_bv_vx_min, m_bv_vx_max);
+
+    PreallocatableSplineInterpolatorX const spline_x_interpolator
+            = PreallocatableSplineInterpolatorX(builder_x, spline_x_evaluator);
+
+    PreallocatableSplineInterpolatorVx const spline_vx_interpolator
+            = PreallocatableSplineInterpolatorVx(builder_vx, spline_vx_evaluator);
+
+    BslAdvectionSpatial<GeometryXVx, IDimX> const advection_x
+            = BslAdvectionSpatial<GeometryXVx, IDimX>(spline_x_interpolator);
+
+    BslAdvectionVelocity<GeometryXVx, IDimVx> const advection_vx
+            = BslAdvectionVelocity<GeometryXVx, IDimVx>(spline_vx_interpolator);
+
+    SplitVlasovSolver const vlasov = SplitVlasovSolver(advection_x, advection_vx);
+
+    FemPeriodicPoissonSolver const poisson
+            = FemPeriodicPoissonSolver(builder_x, spline_x_evaluator, builder_vx);
+
+    LandauTestCase() = default;
+
+    LandauTestCase(LandauTestCase const& x) = delete;
+
+    LandauTestCase(LandauTestCase&& x) = delete;
+
+    ~LandauTestCase() = default;
+
+    LandauTestCase& operator=(LandauTestCase const& x) = delete;
+
+    LandauTestCase& operator=(LandauTestCase&& x) = delete;
+
+    /**
+     * @brief Initialise the distribution function with a perturbed Maxwellian.
+     * @param[out] allfdistribu The distribution function on the mesh of the case.
+     */
+    void initialize(DSpanSpXVx const allfdistribu) const
+    {
+        IDomainSp const dom_kinsp = allfdistribu.domain<IDimSp>();
+        DFieldSp density_eq(dom_kinsp);
+        ddc::fill(density_eq, 1.);
+        DFieldSp temperature_eq(dom_kinsp);
+        ddc::fill(temperature_eq, 1.);
+        DFieldSp mean_velocity_eq(dom_kinsp);
+        ddc::fill(mean_velocity_eq, 0.);
+
+        DFieldSpVx allfequilibrium(IDomainSpVx(dom_kinsp, allfdistribu.domain<IDimVx>()));
+        MaxwellianEquilibrium const init_fequilibrium(
+                std::move(density_eq),
+                std::move(temperature_eq),
+                std::move(mean_velocity_eq));
+        init_fequilibrium(allfequilibrium);
+        SingleModePerturbInitialization const
+                init(allfequilibrium,
+                     ddc::discrete_space<IDimSp>().perturb_modes(),
+                     ddc::discrete_space<IDimSp>().perturb_amplitudes());
+        init(allfdistribu);
+    }
+};
+
+/**
+ * @brief The largest absolute difference between two distribution functions.
+ * @param[in] fdistribu A distribution function.
+ * @param[in] fdistribu_ref Another distribution function on the same mesh.
+ * @return The maximum norm of the difference.
+ */
+inline double max_difference(DViewSpXVx const fdistribu, DViewSpXVx const fdistribu_ref)
+{
+    return ddc::transform_reduce(
+            fdistribu.domain(),
+            0.,
+            ddc::reducer::max<double>(),
+            [&](IndexSpXVx const ispxvx) {
+                return std::fabs(fdistribu(ispxvx) - fdistribu_ref(ispxvx));
+            });
+}
+
+/**
+ * @brief Advance the Landau case from its initial state up to a final time.
+ * @param[in] landau The Landau case.
+ * @param[in] time_solver The time solver.
+ * @param[out] allfdistribu The distribution function at the final time.
+ * @param[in] dt The time step.
+ * @param[in] final_time The final time, a multiple of the time step.
+ */
+inline void run_landau(
+        LandauTestCase const& landau,
+        ITimeSolver const& time_solver,
+        DSpanSpXVx const allfdistribu,
+        double const dt,
+        double const final_time)
+{
+    landau.initialize(allfdistribu);
+    time_solver(allfdistribu, dt, static_cast<int>(std::lround(final_time / dt)));
+}
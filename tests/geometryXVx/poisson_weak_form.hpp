@@ -0,0 +1,87 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <array>
+#include <cmath>
+
+#include <ddc/ddc.hpp>
+
+#include <sll/gauss_legendre_integration.hpp>
+#include <sll/spline_builder.hpp>
+#include <sll/spline_evaluator.hpp>
+
+#include <geometry.hpp>
+
+/**
+ * @brief The largest residual of the weak form of the Poisson equation
+ * \int phi'(x) b_i'(x) dx = \int rho(x) b_i(x) dx over a range of B-splines b_i.
+ *
+ * The integrals are assembled cell by cell with the Gauss-Legendre quadrature of the finite
+ * element solvers, evaluating the splines of phi and rho at each Gauss point, so the residual
+ * only contains round-off errors if the solvers build the same systems.
+ *
+ * @param[in] electrostatic_potential The potential phi at the interpolation points.
+ * @param[in] rho The charge density at the interpolation points.
+ * @param[in] spline_x_builder A spline builder on the spatial mesh.
+ * @param[in] spline_x_evaluator A spline evaluator along x.
+ * @param[in] first_basis The index of the first test function.
+ * @param[in] last_basis The index after the last test function.
+ * @return The maximum norm of the residual.
+ */
+inline double poisson_weak_form_residual(
+        DViewX const electrostatic_potential,
+        DViewX const rho,
+        SplineXBuilder const& spline_x_builder,
+        SplineEvaluator<BSplinesX> const& spline_x_evaluator,
+        int const first_basis,
+        int const last_basis)
+{
+    int constexpr degree = BSplinesX::degree();
+    int const nbasis = ddc::discrete_space<BSplinesX>().nbasis();
+    int const ncells = ddc::discrete_space<BSplinesX>().ncells();
+
+    ddc::Chunk<double, BSDomainX> phi_spline_coef(spline_x_builder.spline_domain());
+    ddc::Chunk<double, BSDomainX> rho_spline_coef(spline_x_builder.spline_domain());
+    spline_x_builder(phi_spline_coef, electrostatic_potential);
+    spline_x_builder(rho_spline_coef, rho);
+
+    // The value, or the derivative, of the B-spline ibasis at x
+    auto const basis = [&](int const ibasis, double const x, bool const derivative) {
+        std::array<double, degree + 1> values_ptr;
+        DSpan1D const values(values_ptr.data(), values_ptr.size());
+        ddc::DiscreteElement<BSplinesX> const jmin
+                = derivative ? ddc::discrete_space<BSplinesX>().eval_deriv(values, CoordX(x))
+                             : ddc::discrete_space<BSplinesX>().eval_basis(values, CoordX(x));
+        // the indices of the periodic B-splines are taken modulo the number of basis functions
+        int const j = ((ibasis - int(jmin.uid())) % nbasis + nbasis) % nbasis;
+        return j <= degree ? values(j) : 0.;
+    };
+
+    GaussLegendre<RDimX> const gl(degree + 1);
+    double residual = 0.;
+    for (int ibasis = first_basis; ibasis < last_basis; ++ibasis) {
+        double stiffness = 0.;
+        double mass = 0.;
+        for (int icell = 0; icell < ncells; ++icell) {
+            double const x0 = ddc::discrete_space<BSplinesX>().get_knot(icell);
+            double const x1 = ddc::discrete_space<BSplinesX>().get_knot(icell + 1);
+            stiffness += gl.integrate(
+                    [&](double const x) {
+                        return spline_x_evaluator.deriv(CoordX(x), phi_spline_coef.span_cview())
+                               * basis(ibasis, x, true);
+                    },
+                    x0,
+                    x1);
+            mass += gl.integrate(
+                    [&](double const x) {
+                        return spline_x_evaluator(CoordX(x), rho_spline_coef.span_cview())
+                               * basis(ibasis, x, false);
+                    },
+                    x0,
+                    x1);
+        }
+        residual = std::fmax(residual, std::fabs(stiffness - mass));
+    }
+    return residual;
+}
@@ -0,0 +1,136 @@
+// SPDX-License-Identifier: MIT
+
+#include <array>
+#include <cmath>
+#include <stdexcept>
+
+#include <ddc/ddc.hpp>
+
+#include <gtest/gtest.h>
+
+#include <geometry.hpp>
+#include <maxwellianequilibrium.hpp>
+#include <reduced_diagnostics.hpp>
+
+/**
+ * Computes the diagnostics of a drifting Maxwellian whose density is a single Fourier mode,
+ * with a potential and an electric field made of a few modes, and compares them with their
+ * analytic values.
+ */
+TEST(ReducedDiagnostics, DriftingMaxwellian)
+{
+    CoordX const x_min(0.0);
+    CoordX const x_max(2.0 * M_PI);
+    IVectX const x_size(32);
+
+    CoordVx const vx_min(-10.);
+    CoordVx const vx_max(10.);
+    IVectVx const vx_size(200);
+
+    IDomainSp const dom_sp(IndexSp(0), IVectSp(2));
+    IndexSp const my_ielec = dom_sp.front();
+    IndexSp const my_iion = dom_sp.back();
+
+    ddc::init_discrete_space<BSplinesX>(x_min, x_max, x_size);
+    ddc::init_discrete_space<BSplinesVx>(vx_min, vx_max, vx_size);
+
+    ddc::init_discrete_space<IDimX>(SplineInterpPointsX::get_sampling());
+    ddc::init_discrete_space<IDimVx>(SplineInterpPointsVx::get_sampling());
+
+    IDomainX const gridx(SplineInterpPointsX::get_domain());
+    IDomainVx const gridvx(SplineInterpPointsVx::get_domain());
+    IDomainSpXVx const mesh(dom_sp, gridx, gridvx);
+
+    FieldSp<int> charges(dom_sp);
+    charges(my_ielec) = -1;
+    charges(my_iion) = 1;
+    DFieldSp masses(dom_sp);
+    ddc::fill(masses, 1.);
+    FieldSp<int> init_perturb_mode(dom_sp);
+    ddc::fill(init_perturb_mode, 0);
+    DFieldSp init_perturb_amplitude(dom_sp);
+    ddc::fill(init_perturb_amplitude, 0.);
+
+    ddc::init_discrete_space<IDimSp>(
+            std::move(charges),
+            std::move(masses),
+            std::move(init_perturb_amplitude),
+            std::move(init_perturb_mode));
+
+    double const amplitude = 0.1;
+    double const mean_velocity = 0.5;
+    double const temperature = 1.;
+    auto const density = [&](IndexX const ix) {
+        return 1. + amplitude * std::cos(double(ddc::coordinate(ix)));
+    };
+
+    DFieldSpXVx allfdistribu(mesh);
+    ddc::for_each(ddc::select<IDimSp, IDimX>(mesh), [&](IndexSpX const ispx) {
+        MaxwellianEquilibrium::compute_maxwellian(
+                allfdistribu[ispx],
+                density(ddc::select<IDimX>(ispx)),
+                temperature,
+                mean_velocity);
+    });
+
+    DFieldX electrostatic_potential(gridx);
+    DFieldX electric_field(gridx);
+    ddc::for_each(gridx, [&](IndexX const ix) {
+        double const x = ddc::coordinate(ix);
+        electrostatic_potential(ix) = 0.1 + 0.3 * std::cos(2. * x);
+        electric_field(ix) = std::sin(x);
+    });
+
+    int const nb_modes = 4;
+    ReducedDiagnostics const diagnostics(mesh, 1, 1, nb_modes);
+    diagnostics.compute_scalars(allfdistribu, electrostatic_potential, electric_field);
+    diagnostics.compute_profiles(allfdistribu);
+
+    double const tolerance = 1.e-10;
+
+    // 0.5 * int sin(x)^2 dx over a period
+    EXPECT_NEAR(diagnostics.field_energy(), 0.5 * M_PI, tolerance);
+
+    // only the modes 0 and 2 of the potential are present, with half of the amplitude of the
+    // cosine for the mode 2
+    auto const modes = diagnostics.potential_modes();
+    std::array<double, nb_modes> const modes_ref {0.1, 0., 0.15, 0.};
+    for (ddc::DiscreteElement<ReducedDiagnostics::IDimMode> const imode : modes.domain()) {
+        EXPECT_NEAR(modes(imode), modes_ref[imode.uid()], tolerance);
+    }
+
+    double const n_left = density(gridx.front());
+    double const n_right = density(gridx.back());
+    double const energy_flux_factor
+            = 0.5 * (mean_velocity * mean_velocity * mean_velocity
+                     + 3. * mean_velocity * temperature);
+    for (IndexSp const isp : dom_sp) {
+        // 0.5 * int n(x) (T + u^2) dx over a period
+        EXPECT_NEAR(
+                diagnostics.kinetic_energy()(isp),
+                M_PI * (temperature + mean_velocity * mean_velocity),
+                tolerance);
+        EXPECT_NEAR(diagnostics.particle_flux_left()(isp), n_left * mean_velocity, tolerance);
+        EXPECT_NEAR(diagnostics.particle_flux_right()(isp), n_right * mean_velocity, tolerance);
+        EXPECT_NEAR(diagnostics.energy_flux_left()(isp), n_left * energy_flux_factor, tolerance);
+        EXPECT_NEAR(
+                diagnostics.energy_flux_right()(isp),
+                n_right * energy_flux_factor,
+                tolerance);
+    }
+
+    ddc::for_each(ddc::select<IDimSp, IDimX>(mesh), [&](IndexSpX const ispx) {
+        double const n = density(ddc::select<IDimX>(ispx));
+        EXPECT_NEAR(diagnostics.density()(ispx), n, tolerance);
+        EXPECT_NEAR(diagnostics.mean_velocity()(ispx), mean_velocity, tolerance);
+        EXPECT_NEAR(diagnostics.temperature()(ispx), temperature, tolerance);
+        EXPECT_NEAR(diagnostics.particle_flux()(ispx), n * mean_velocity, tolerance);
+        // the central third moment of a Maxwellian vanishes
+        EXPECT_NEAR(diagnostics.heat_flux()(ispx), 0., tolerance);
+    });
+
+    // the modes above Nx/2 are aliases of the lower ones
+    EXPECT_THROW(
+            ReducedDiagnostics(mesh, 1, 1, gridx.size() / 2 + 2),
+            std::invalid_argument);
+}
@@ -0,0 +1,67 @@
+// SPDX-License-Identifier: MIT
+
+#include <cmath>
+
+#include <ddc/ddc.hpp>
+
+#include <gtest/gtest.h>
+
+#include <paraconf.h>
+#include <pdi.h>
+
+#include "geometry.hpp"
+#include "landau_test_case.hpp"
+#include "predcorr.hpp"
+#include "symplecticsplitting.hpp"
+
+namespace {
+
+/**
+ * Measures the order of a splitting scheme from its errors at two time steps with respect to a
+ * run with a much smaller time step, and compares this run to the predictor-corrector.
+ */
+void check_splitting_order(SplittingScheme const scheme, double const dt, double const order)
+{
+    PC_tree_t conf_pdi = PC_parse_string("");
+    PDI_init(conf_pdi);
+
+    LandauTestCase const landau;
+    SymplecticSplitting const
+            time_solver(landau.advection_x, landau.advection_vx, landau.poisson, scheme);
+    double const final_time = 4.;
+
+    DFieldSpXVx allfdistribu_ref(landau.mesh);
+    run_landau(landau, time_solver, allfdistribu_ref, dt / 8., final_time);
+
+    DFieldSpXVx allfdistribu_coarse(landau.mesh);
+    run_landau(landau, time_solver, allfdistribu_coarse, dt, final_time);
+    double const error_coarse = max_difference(allfdistribu_coarse, allfdistribu_ref);
+
+    DFieldSpXVx allfdistribu_fine(landau.mesh);
+    run_landau(landau, time_solver, allfdistribu_fine, dt / 2., final_time);
+    double const error_fine = max_difference(allfdistribu_fine, allfdistribu_ref);
+
+    double const observed_order = std::log2(error_coarse / error_fine);
+    EXPECT_GE(observed_order, order - 0.5);
+
+    // the schemes solve the same problem as the second order predictor-corrector
+    PredCorr const predcorr(landau.vlasov, landau.poisson);
+    DFieldSpXVx allfdistribu_predcorr(landau.mesh);
+    run_landau(landau, predcorr, allfdistribu_predcorr, dt / 8., final_time);
+    EXPECT_LE(max_difference(allfdistribu_ref, allfdistribu_predcorr), 1.e-3);
+
+    PC_tree_destroy(&conf_pdi);
+    PDI_finalize();
+}
+
+} // namespace
+
+TEST(SymplecticSplitting, Ruth3Order)
+{
+    check_splitting_order(SplittingScheme::Ruth3, 0.2, 3.);
+}
+
+TEST(SymplecticSplitting, Yoshida4Order)
+{
+    check_splitting_order(SplittingScheme::Yoshida4, 0.4, 4.);
+}
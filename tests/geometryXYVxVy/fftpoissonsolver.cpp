@@ -0,0 +1,126 @@
+// SPDX-License-Identifier: MIT
+
+#include <cmath>
+
+#include <ddc/ddc.hpp>
+
+#include <sll/null_boundary_value.hpp>
+#include <sll/spline_builder.hpp>
+#include <sll/spline_evaluator_2d.hpp>
+
+#include <gtest/gtest.h>
+
+#include "fftpoissonsolver.hpp"
+#include "geometry.hpp"
+#include "species_info.hpp"
+
+/**
+ * The spectral electric field of a single Fourier mode of the charge density is exact up to
+ * round-off errors.
+ */
+TEST(FftPoissonSolver, SpectralElectricField)
+{
+    CoordX const x_min(0.0);
+    CoordX const x_max(2.0 * M_PI);
+    IVectX const x_size(16);
+
+    CoordY const y_min(0.0);
+    CoordY const y_max(2.0 * M_PI);
+    IVectY const y_size(12);
+
+    CoordVx const vx_min(-0.5);
+    CoordVx const vx_max(0.5);
+    IVectVx const vx_size(6);
+
+    CoordVy const vy_min(-0.5);
+    CoordVy const vy_max(0.5);
+    IVectVy const vy_size(6);
+
+    IVectSp const nb_species(2);
+    IDomainSp const dom_sp(IndexSp(0), nb_species);
+    IndexSp const my_ielec = dom_sp.front();
+    IndexSp const my_iion = dom_sp.back();
+
+    // Creating mesh & supports
+    ddc::init_discrete_space<BSplinesX>(x_min, x_max, x_size);
+    ddc::init_discrete_space<BSplinesY>(y_min, y_max, y_size);
+    ddc::init_discrete_space<BSplinesVx>(vx_min, vx_max, vx_size);
+    ddc::init_discrete_space<BSplinesVy>(vy_min, vy_max, vy_size);
+
+    ddc::init_discrete_space<IDimX>(SplineInterpPointsX::get_sampling());
+    ddc::init_discrete_space<IDimY>(SplineInterpPointsY::get_sampling());
+    ddc::init_discrete_space<IDimVx>(SplineInterpPointsVx::get_sampling());
+    ddc::init_discrete_space<IDimVy>(SplineInterpPointsVy::get_sampling());
+
+    IDomainX const gridx(SplineInterpPointsX::get_domain());
+    IDomainY const gridy(SplineInterpPointsY::get_domain());
+    IDomainVx const gridvx(SplineInterpPointsVx::get_domain());
+    IDomainVy const gridvy(SplineInterpPointsVy::get_domain());
+    IDomainXY const gridxy(gridx, gridy);
+    IDomainSp const gridsp = IDomainSp(my_iion, IVectSp(1));
+
+    IDomainSpXYVxVy const mesh(gridsp, gridx, gridy, gridvx, gridvy);
+
+    SplineXYBuilder const builder_xy(gridxy);
+    SplineVxVyBuilder const builder_vxvy(ddc::DiscreteDomain<IDimVx, IDimVy>(gridvx, gridvy));
+
+    SplineXYEvaluator const spline_xy_evaluator(
+            g_null_boundary_2d<BSplinesX, BSplinesY>,
+            g_null_boundary_2d<BSplinesX, BSplinesY>,
+            g_null_boundary_2d<BSplinesX, BSplinesY>,
+            g_null_boundary_2d<BSplinesX, BSplinesY>);
+
+    FieldSp<int> charges(dom_sp);
+    charges(my_ielec) = -1;
+    charges(my_iion) = 1;
+    DFieldSp masses(dom_sp);
+    ddc::fill(masses, 1);
+    FieldSp<int> init_perturb_mode(dom_sp);
+    ddc::fill(init_perturb_mode, 0);
+    DFieldSp init_perturb_amplitude(dom_sp);
+    ddc::fill(init_perturb_amplitude, 0);
+
+    ddc::init_discrete_space<IDimSp>(
+            std::move(charges),
+            std::move(masses),
+            std::move(init_perturb_amplitude),
+            std::move(init_perturb_mode));
+
+    FftPoissonSolver const
+            poisson(builder_xy, spline_xy_evaluator, builder_vxvy, true);
+
+    DFieldXY electrostatic_potential(gridxy);
+    DFieldXY electric_field_x(gridxy);
+    DFieldXY electric_field_y(gridxy);
+    DFieldSpXYVxVy allfdistribu(mesh);
+
+    // The charge density is cos(x + 2y) so Phi = cos(x + 2y) / 5, Ex = sin(x + 2y) / 5 and
+    // Ey = 2 sin(x + 2y) / 5
+    ddc::for_each(mesh, [&](IndexSpXYVxVy const ispxyvxvy) {
+        double const x = ddc::coordinate(ddc::select<IDimX>(ispxyvxvy));
+        double const y = ddc::coordinate(ddc::select<IDimY>(ispxyvxvy));
+        allfdistribu(ispxyvxvy) = std::cos(x + 2. * y);
+    });
+
+    poisson(electrostatic_potential, electric_field_x, electric_field_y, allfdistribu);
+
+    double error_pot = 0.0;
+    double error_field_x = 0.0;
+    double error_field_y = 0.0;
+    for (IndexXY const ixy : gridxy) {
+        double const x = ddc::coordinate(ddc::select<IDimX>(ixy));
+        double const y = ddc::coordinate(ddc::select<IDimY>(ixy));
+        error_pot = std::fmax(
+                std::fabs(electrostatic_potential(ixy) - std::cos(x + 2. * y) / 5.),
+                error_pot);
+        error_field_x = std::fmax(
+                std::fabs(electric_field_x(ixy) - std::sin(x + 2. * y) / 5.),
+                error_field_x);
+        error_field_y = std::fmax(
+                std::fabs(electric_field_y(ixy) - 2. * std::sin(x + 2. * y) / 5.),
+                error_field_y);
+    }
+    EXPECT_LE(error_pot, 1e-12);
+    EXPECT_LE(error_field_x, 1e-12);
+    EXPECT_LE(error_field_y, 1e-12);
+}
@@ -0,0 +1,231 @@
+// SPDX-License-Identifier: MIT
+
+#include <cmath>
+
+#include <ddc/ddc.hpp>
+
+#include <sll/constant_extrapolation_boundary_value.hpp>
+#include <sll/null_boundary_value.hpp>
+#include <sll/spline_evaluator.hpp>
+#include <sll/spline_evaluator_2d.hpp>
+
+#include <gtest/gtest.h>
+
+#include <paraconf.h>
+#include <pdi.h>
+
+#include "bsl_advection_vx.hpp"
+#include "bsl_advection_x.hpp"
+#include "fftpoissonsolver.hpp"
+#include "geometry.hpp"
+#include "predcorr.hpp"
+#include "species_info.hpp"
+#include "spline_interpolator.hpp"
+#include "splitvlasovsolver.hpp"
+#include "symplecticsplitting.hpp"
+
+namespace {
+
+using PreallocatableSplineInterpolatorX
+        = PreallocatableSplineInterpolator<IDimX, BSplinesX, SplineXBoundary, SplineXBoundary>;
+using PreallocatableSplineInterpolatorY
+        = PreallocatableSplineInterpolator<IDimY, BSplinesY, SplineYBoundary, SplineYBoundary>;
+using PreallocatableSplineInterpolatorVx = PreallocatableSplineInterpolator<
+        IDimVx,
+        BSplinesVx,
+        BoundCond::HERMITE,
+        BoundCond::HERMITE>;
+using PreallocatableSplineInterpolatorVy = PreallocatableSplineInterpolator<
+        IDimVy,
+        BSplinesVy,
+        BoundCond::HERMITE,
+        BoundCond::HERMITE>;
+
+/**
+ * Initialises a Maxwellian of the electrons perturbed along x and y.
+ */
+void initialize(DSpanSpXYVxVy const allfdistribu)
+{
+    ddc::for_each(allfdistribu.domain(), [&](IndexSpXYVxVy const ispxyvxvy) {
+        double const x = ddc::coordinate(ddc::select<IDimX>(ispxyvxvy));
+        double const y = ddc::coordinate(ddc::select<IDimY>(ispxyvxvy));
+        double const vx = ddc::coordinate(ddc::select<IDimVx>(ispxyvxvy));
+        double const vy = ddc::coordinate(ddc::select<IDimVy>(ispxyvxvy));
+        allfdistribu(ispxyvxvy) = (1. + 0.05 * std::cos(0.5 * x) + 0.02 * std::cos(0.5 * y))
+                                  * std::exp(-0.5 * (vx * vx + vy * vy)) / (2. * M_PI);
+    });
+}
+
+/**
+ * The largest absolute difference between two distribution functions.
+ */
+double max_difference(DViewSpXYVxVy const fdistribu, DViewSpXYVxVy const fdistribu_ref)
+{
+    return ddc::transform_reduce(
+            fdistribu.domain(),
+            0.,
+            ddc::reducer::max<double>(),
+            [&](IndexSpXYVxVy const ispxyvxvy) {
+                return std::fabs(fdistribu(ispxyvxvy) - fdistribu_ref(ispxyvxvy));
+            });
+}
+
+/**
+ * Measures the order of a splitting scheme on a small Landau case from its errors at two time
+ * steps with respect to a run with a much smaller time step, and compares this run to the
+ * predictor-corrector.
+ */
+void check_splitting_order(SplittingScheme const scheme, double const dt, double const order)
+{
+    PC_tree_t conf_pdi = PC_parse_string("");
+    PDI_init(conf_pdi);
+
+    CoordX const x_min(0.0);
+    CoordX const x_max(4.0 * M_PI);
+    IVectX const x_size(32);
+
+    CoordY const y_min(0.0);
+    CoordY const y_max(4.0 * M_PI);
+    IVectY const y_size(16);
+
+    CoordVx const vx_min(-6.0);
+    CoordVx const vx_max(6.0);
+    IVectVx const vx_size(32);
+
+    CoordVy const vy_min(-6.0);
+    CoordVy const vy_max(6.0);
+    IVectVy const vy_size(16);
+
+    // kinetic electrons and adiabatic ions
+    IDomainSp const dom_sp(IndexSp(0), IVectSp(2));
+    IndexSp const my_ielec = dom_sp.front();
+    IndexSp const my_iion = dom_sp.back();
+
+    ddc::init_discrete_space<BSplinesX>(x_min, x_max, x_size);
+    ddc::init_discrete_space<BSplinesY>(y_min, y_max, y_size);
+    ddc::init_discrete_space<BSplinesVx>(vx_min, vx_max, vx_size);
+    ddc::init_discrete_space<BSplinesVy>(vy_min, vy_max, vy_size);
+
+    ddc::init_discrete_space<IDimX>(SplineInterpPointsX::get_sampling());
+    ddc::init_discrete_space<IDimY>(SplineInterpPointsY::get_sampling());
+    ddc::init_discrete_space<IDimVx>(SplineInterpPointsVx::get_sampling());
+    ddc::init_discrete_space<IDimVy>(SplineInterpPointsVy::get_sampling());
+
+    IDomainX const gridx(SplineInterpPointsX::get_domain());
+    IDomainY const gridy(SplineInterpPointsY::get_domain());
+    IDomainVx const gridvx(SplineInterpPointsVx::get_domain());
+    IDomainVy const gridvy(SplineInterpPointsVy::get_domain());
+    IDomainXY const gridxy(gridx, gridy);
+
+    IDomainSpXYVxVy const mesh(IDomainSp(my_ielec, IVectSp(1)), gridx, gridy, gridvx, gridvy);
+
+    FieldSp<int> charges(dom_sp);
+    charges(my_ielec) = -1;
+    charges(my_iion) = 1;
+    DFieldSp masses(dom_sp);
+    ddc::fill(masses, 1.);
+    FieldSp<int> init_perturb_mode(dom_sp);
+    ddc::fill(init_perturb_mode, 0);
+    DFieldSp init_perturb_amplitude(dom_sp);
+    ddc::fill(init_perturb_amplitude, 0.);
+
+    ddc::init_discrete_space<IDimSp>(
+            std::move(charges),
+            std::move(masses),
+            std::move(init_perturb_amplitude),
+            std::move(init_perturb_mode));
+
+    // Creating operators
+    SplineXBuilder const builder_x(gridx);
+    ConstantExtrapolationBoundaryValue<BSplinesX> const bv_x_min(x_min);
+    ConstantExtrapolationBoundaryValue<BSplinesX> const bv_x_max(x_max);
+    SplineEvaluator<BSplinesX> const spline_x_evaluator(bv_x_min, bv_x_max);
+    PreallocatableSplineInterpolatorX const spline_x_interpolator(builder_x, spline_x_evaluator);
+
+    SplineYBuilder const builder_y(gridy);
+    ConstantExtrapolationBoundaryValue<BSplinesY> const bv_y_min(y_min);
+    ConstantExtrapolationBoundaryValue<BSplinesY> const bv_y_max(y_max);
+    SplineEvaluator<BSplinesY> const spline_y_evaluator(bv_y_min, bv_y_max);
+    PreallocatableSplineInterpolatorY const spline_y_interpolator(builder_y, spline_y_evaluator);
+
+    SplineVxBuilder const builder_vx(gridvx);
+    ConstantExtrapolationBoundaryValue<BSplinesVx> const bv_vx_min(vx_min);
+    ConstantExtrapolationBoundaryValue<BSplinesVx> const bv_vx_max(vx_max);
+    SplineEvaluator<BSplinesVx> const spline_vx_evaluator(bv_vx_min, bv_vx_max);
+    PreallocatableSplineInterpolatorVx const
+            spline_vx_interpolator(builder_vx, spline_vx_evaluator);
+
+    SplineVyBuilder const builder_vy(gridvy);
+    ConstantExtrapolationBoundaryValue<BSplinesVy> const bv_vy_min(vy_min);
+    ConstantExtrapolationBoundaryValue<BSplinesVy> const bv_vy_max(vy_max);
+    SplineEvaluator<BSplinesVy> const spline_vy_evaluator(bv_vy_min, bv_vy_max);
+    PreallocatableSplineInterpolatorVy const
+            spline_vy_interpolator(builder_vy, spline_vy_evaluator);
+
+    SplineXYBuilder const builder_xy(gridxy);
+    SplineVxVyBuilder const builder_vxvy(ddc::DiscreteDomain<IDimVx, IDimVy>(gridvx, gridvy));
+    SplineXYEvaluator const spline_xy_evaluator(
+            g_null_boundary_2d<BSplinesX, BSplinesY>,
+            g_null_boundary_2d<BSplinesX, BSplinesY>,
+            g_null_boundary_2d<BSplinesX, BSplinesY>,
+            g_null_boundary_2d<BSplinesX, BSplinesY>);
+
+    BslAdvectionSpatial<GeometryXYVxVy, IDimX> const advection_x(spline_x_interpolator);
+    BslAdvectionSpatial<GeometryXYVxVy, IDimY> const advection_y(spline_y_interpolator);
+    BslAdvectionVelocity<GeometryXYVxVy, IDimVx> const advection_vx(spline_vx_interpolator);
+    BslAdvectionVelocity<GeometryXYVxVy, IDimVy> const advection_vy(spline_vy_interpolator);
+
+    FftPoissonSolver const poisson(builder_xy, spline_xy_evaluator, builder_vxvy);
+
+    SymplecticSplitting const time_solver(
+            advection_x,
+            advection_y,
+            advection_vx,
+            advection_vy,
+            poisson,
+            scheme);
+    double const final_time = 2.4;
+
+    auto const run = [&](ITimeSolver const& solver,
+                         DSpanSpXYVxVy const allfdistribu,
+                         double const step) {
+        initialize(allfdistribu);
+        solver(allfdistribu, step, static_cast<int>(std::lround(final_time / step)));
+    };
+
+    DFieldSpXYVxVy allfdistribu_ref(mesh);
+    run(time_solver, allfdistribu_ref, dt / 8.);
+
+    DFieldSpXYVxVy allfdistribu_coarse(mesh);
+    run(time_solver, allfdistribu_coarse, dt);
+    double const error_coarse = max_difference(allfdistribu_coarse, allfdistribu_ref);
+
+    DFieldSpXYVxVy allfdistribu_fine(mesh);
+    run(time_solver, allfdistribu_fine, dt / 2.);
+    double const error_fine = max_difference(allfdistribu_fine, allfdistribu_ref);
+
+    double const observed_order = std::log2(error_coarse / error_fine);
+    EXPECT_GE(observed_order, order - 0.5);
+
+    // the schemes solve the same problem as the second order predictor-corrector
+    SplitVlasovSolver const vlasov(advection_x, advection_y, advection_vx, advection_vy);
+    PredCorr const predcorr(vlasov, poisson);
+    DFieldSpXYVxVy allfdistribu_predcorr(mesh);
+    run(predcorr, allfdistribu_predcorr, dt / 8.);
+    EXPECT_LE(max_difference(allfdistribu_ref, allfdistribu_predcorr), 1.e-3);
+
+    PC_tree_destroy(&conf_pdi);
+    PDI_finalize();
+}
+
+} // namespace
+
+TEST(SymplecticSplitting, Ruth3Order)
+{
+    check_splitting_order(SplittingScheme::Ruth3, 0.4, 3.);
+}
+
+TEST(SymplecticSplitting, Yoshida4Order)
+{
+    check_splitting_order(SplittingScheme::Yoshida4, 0.8, 4.);
+}
@@ -0,0 +1,47 @@
+// SPDX-License-Identifier: MIT
+
+#include <ddc/ddc.hpp>
+
+#include <gtest/gtest.h>
+
+#include "geometry.hpp"
+#include "transpose.hpp"
+
+TEST(TransposeTest, LayoutRoundTrip)
+{
+    // The sizes are not multiples of the tile size to check the incomplete tiles
+    IDomainSp const dom_sp(IndexSp(0), IVectSp(2));
+    IDomainX const dom_x(IndexX(0), IVectX(37));
+    IDomainY const dom_y(IndexY(0), IVectY(5));
+    IDomainVx const dom_vx(IndexVx(0), IVectVx(11));
+    IDomainVy const dom_vy(IndexVy(0), IVectVy(7));
+
+    IDomainSpXYVxVy const dom(dom_sp, dom_x, dom_y, dom_vx, dom_vy);
+    IDomainSpVxVyXY const dom_transposed(dom_sp, dom_vx, dom_vy, dom_x, dom_y);
+
+    DFieldSpXYVxVy fdistribu(dom);
+    ddc::for_each(dom, [&](IndexSpXYVxVy const ispxyvxvy) {
+        fdistribu(ispxyvxvy) = ddc::select<IDimSp>(ispxyvxvy).uid()
+                               + 10. * ddc::select<IDimX>(ispxyvxvy).uid()
+                               + 1.e3 * ddc::select<IDimY>(ispxyvxvy).uid()
+                               + 1.e4 * ddc::select<IDimVx>(ispxyvxvy).uid()
+                               + 1.e6 * ddc::select<IDimVy>(ispxyvxvy).uid();
+    });
+
+    DFieldSpVxVyXY fdistribu_transposed(dom_transposed);
+    transpose_layout(fdistribu_transposed.span_view(), fdistribu.span_cview());
+    ddc::for_each(dom, [&](IndexSpXYVxVy const ispxyvxvy) {
+        IndexSp const isp = ddc::select<IDimSp>(ispxyvxvy);
+        IndexX const ix = ddc::select<IDimX>(ispxyvxvy);
+        IndexY const iy = ddc::select<IDimY>(ispxyvxvy);
+        IndexVx const ivx = ddc::select<IDimVx>(ispxyvxvy);
+        IndexVy const ivy = ddc::select<IDimVy>(ispxyvxvy);
+        EXPECT_EQ(fdistribu_transposed(isp, ivx, ivy, ix, iy), fdistribu(ispxyvxvy));
+    });
+
+    DFieldSpXYVxVy fdistribu_back(dom);
+    transpose_layout(fdistribu_back.span_view(), fdistribu_transposed.span_cview());
+    ddc::for_each(dom, [&](IndexSpXYVxVy const ispxyvxvy) {
+        EXPECT_EQ(fdistribu_back(ispxyvxvy), fdistribu(ispxyvxvy));
+    });
+}
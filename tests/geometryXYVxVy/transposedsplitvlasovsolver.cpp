@@ -0,0 +1,175 @@
+// SPDX-License-Identifier: MIT
+
+#include <cmath>
+
+#include <ddc/ddc.hpp>
+
+#include <sll/constant_extrapolation_boundary_value.hpp>
+#include <sll/spline_evaluator.hpp>
+
+#include <gtest/gtest.h>
+
+#include "bsl_advection_vx.hpp"
+#include "bsl_advection_x.hpp"
+#include "geometry.hpp"
+#include "species_info.hpp"
+#include "spline_interpolator.hpp"
+#include "splitvlasovsolver.hpp"
+#include "transposedsplitvlasovsolver.hpp"
+
+namespace {
+
+using PreallocatableSplineInterpolatorX
+        = PreallocatableSplineInterpolator<IDimX, BSplinesX, SplineXBoundary, SplineXBoundary>;
+using PreallocatableSplineInterpolatorY
+        = PreallocatableSplineInterpolator<IDimY, BSplinesY, SplineYBoundary, SplineYBoundary>;
+using PreallocatableSplineInterpolatorVx = PreallocatableSplineInterpolator<
+        IDimVx,
+        BSplinesVx,
+        BoundCond::HERMITE,
+        BoundCond::HERMITE>;
+using PreallocatableSplineInterpolatorVy = PreallocatableSplineInterpolator<
+        IDimVy,
+        BSplinesVy,
+        BoundCond::HERMITE,
+        BoundCond::HERMITE>;
+
+} // namespace
+
+TEST(TransposedSplitVlasovSolver, SameAsSplitVlasovSolver)
+{
+    CoordX const x_min(0.0);
+    CoordX const x_max(2.0 * M_PI);
+    IVectX const x_size(16);
+
+    CoordY const y_min(0.0);
+    CoordY const y_max(2.0 * M_PI);
+    IVectY const y_size(8);
+
+    CoordVx const vx_min(-6.0);
+    CoordVx const vx_max(6.0);
+    IVectVx const vx_size(16);
+
+    CoordVy const vy_min(-6.0);
+    CoordVy const vy_max(6.0);
+    IVectVy const vy_size(12);
+
+    IDomainSp const dom_sp(IndexSp(0), IVectSp(2));
+    IndexSp const my_ielec = dom_sp.front();
+    IndexSp const my_iion = dom_sp.back();
+
+    // Creating mesh & supports
+    ddc::init_discrete_space<BSplinesX>(x_min, x_max, x_size);
+    ddc::init_discrete_space<BSplinesY>(y_min, y_max, y_size);
+    ddc::init_discrete_space<BSplinesVx>(vx_min, vx_max, vx_size);
+    ddc::init_discrete_space<BSplinesVy>(vy_min, vy_max, vy_size);
+
+    ddc::init_discrete_space<IDimX>(SplineInterpPointsX::get_sampling());
+    ddc::init_discrete_space<IDimY>(SplineInterpPointsY::get_sampling());
+    ddc::init_discrete_space<IDimVx>(SplineInterpPointsVx::get_sampling());
+    ddc::init_discrete_space<IDimVy>(SplineInterpPointsVy::get_sampling());
+
+    IDomainX const gridx(SplineInterpPointsX::get_domain());
+    IDomainY const gridy(SplineInterpPointsY::get_domain());
+    IDomainVx const gridvx(SplineInterpPointsVx::get_domain());
+    IDomainVy const gridvy(SplineInterpPointsVy::get_domain());
+
+    IDomainSpXYVxVy const mesh(dom_sp, gridx, gridy, gridvx, gridvy);
+
+    FieldSp<int> charges(dom_sp);
+    charges(my_ielec) = -1;
+    charges(my_iion) = 1;
+    DFieldSp masses(dom_sp);
+    masses(my_ielec) = 1.;
+    masses(my_iion) = 4.;
+    FieldSp<int> init_perturb_mode(dom_sp);
+    ddc::fill(init_perturb_mode, 0);
+    DFieldSp init_perturb_amplitude(dom_sp);
+    ddc::fill(init_perturb_amplitude, 0);
+
+    ddc::init_discrete_space<IDimSp>(
+            std::move(charges),
+            std::move(masses),
+            std::move(init_perturb_amplitude),
+            std::move(init_perturb_mode));
+
+    // Creating operators
+    SplineXBuilder const builder_x(gridx);
+    ConstantExtrapolationBoundaryValue<BSplinesX> const bv_x_min(x_min);
+    ConstantExtrapolationBoundaryValue<BSplinesX> const bv_x_max(x_max);
+    SplineEvaluator<BSplinesX> const spline_x_evaluator(bv_x_min, bv_x_max);
+    PreallocatableSplineInterpolatorX const spline_x_interpolator(builder_x, spline_x_evaluator);
+
+    SplineYBuilder const builder_y(gridy);
+    ConstantExtrapolationBoundaryValue<BSplinesY> const bv_y_min(y_min);
+    ConstantExtrapolationBoundaryValue<BSplinesY> const bv_y_max(y_max);
+    SplineEvaluator<BSplinesY> const spline_y_evaluator(bv_y_min, bv_y_max);
+    PreallocatableSplineInterpolatorY const spline_y_interpolator(builder_y, spline_y_evaluator);
+
+    SplineVxBuilder const builder_vx(gridvx);
+    ConstantExtrapolationBoundaryValue<BSplinesVx> const bv_vx_min(vx_min);
+    ConstantExtrapolationBoundaryValue<BSplinesVx> const bv_vx_max(vx_max);
+    SplineEvaluator<BSplinesVx> const spline_vx_evaluator(bv_vx_min, bv_vx_max);
+    PreallocatableSplineInterpolatorVx const
+            spline_vx_interpolator(builder_vx, spline_vx_evaluator);
+
+    SplineVyBuilder const builder_vy(gridvy);
+    ConstantExtrapolationBoundaryValue<BSplinesVy> const bv_vy_min(vy_min);
+    ConstantExtrapolationBoundaryValue<BSplinesVy> const bv_vy_max(vy_max);
+    SplineEvaluator<BSplinesVy> const spline_vy_evaluator(bv_vy_min, bv_vy_max);
+    PreallocatableSplineInterpolatorVy const
+            spline_vy_interpolator(builder_vy, spline_vy_evaluator);
+
+    BslAdvectionSpatial<GeometryXYVxVy, IDimX> const advection_x(spline_x_interpolator);
+    BslAdvectionSpatial<GeometryXYVxVy, IDimY> const advection_y(spline_y_interpolator);
+    BslAdvectionSpatial<GeometryVxVyXY, IDimX> const advection_x_transposed(
+            spline_x_interpolator);
+    BslAdvectionSpatial<GeometryVxVyXY, IDimY> const advection_y_transposed(
+            spline_y_interpolator);
+    BslAdvectionVelocity<GeometryXYVxVy, IDimVx> const advection_vx(spline_vx_interpolator);
+    BslAdvectionVelocity<GeometryXYVxVy, IDimVy> const advection_vy(spline_vy_interpolator);
+
+    SplitVlasovSolver const vlasov(advection_x, advection_y, advection_vx, advection_vy);
+    TransposedSplitVlasovSolver const vlasov_transposed(
+            mesh,
+            advection_x_transposed,
+            advection_y_transposed,
+            advection_vx,
+            advection_vy);
+
+    DFieldXY electric_field_x(ddc::select<IDimX, IDimY>(mesh));
+    DFieldXY electric_field_y(ddc::select<IDimX, IDimY>(mesh));
+    ddc::for_each(electric_field_x.domain(), [&](IndexXY const ixy) {
+        double const x = ddc::coordinate(ddc::select<IDimX>(ixy));
+        double const y = ddc::coordinate(ddc::select<IDimY>(ixy));
+        electric_field_x(ixy) = 0.1 * std::sin(x) * std::cos(y);
+        electric_field_y(ixy) = 0.1 * std::cos(x) * std::sin(2. * y);
+    });
+
+    DFieldSpXYVxVy allfdistribu(mesh);
+    ddc::for_each(mesh, [&](IndexSpXYVxVy const ispxyvxvy) {
+        double const x = ddc::coordinate(ddc::select<IDimX>(ispxyvxvy));
+        double const y = ddc::coordinate(ddc::select<IDimY>(ispxyvxvy));
+        double const vx = ddc::coordinate(ddc::select<IDimVx>(ispxyvxvy));
+        double const vy = ddc::coordinate(ddc::select<IDimVy>(ispxyvxvy));
+        allfdistribu(ispxyvxvy) = (1. + 0.1 * std::cos(x) + 0.05 * std::sin(y))
+                                  * std::exp(-0.5 * (vx * vx + vy * vy));
+    });
+    DFieldSpXYVxVy allfdistribu_transposed(mesh);
+    ddc::deepcopy(allfdistribu_transposed, allfdistribu);
+
+    double const dt = 0.1;
+    // a second step checks that the buffer of the transposed layout can be reused
+    for (int iter = 0; iter < 2; ++iter) {
+        vlasov(allfdistribu, electric_field_x, electric_field_y, dt);
+        vlasov_transposed(allfdistribu_transposed, electric_field_x, electric_field_y, dt);
+    }
+
+    double max_error = 0.;
+    ddc::for_each(mesh, [&](IndexSpXYVxVy const ispxyvxvy) {
+        max_error = std::fmax(
+                max_error,
+                std::fabs(allfdistribu_transposed(ispxyvxvy) - allfdistribu(ispxyvxvy)));
+    });
+    EXPECT_LE(max_error, 1.e-12);
+}